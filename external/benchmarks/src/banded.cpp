@@ -0,0 +1,72 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#include <mpp/algorithm.hpp>
+#include <mpp/matrix.hpp>
+
+#include "../../include/benchmark_utilities.hpp"
+
+#include <cstddef>
+#include <iostream>
+#include <string_view>
+
+namespace
+{
+	constexpr auto size = std::size_t{ 1'000'000 };
+
+	/**
+	 * Diagonally dominant system like the ones of a 1D finite difference discretization
+	 */
+	template<typename Banded>
+	[[nodiscard]] auto make_system(Banded banded) -> Banded
+	{
+		for (auto row = std::size_t{}; row < banded.rows(); ++row)
+		{
+			for (auto column = banded.first_column(row); column < banded.last_column(row); ++column)
+			{
+				banded.band(row, column) = row == column ? 4.0 : -1.0 / static_cast<double>(banded.row_width());
+			}
+		}
+
+		return banded;
+	}
+
+	void run(std::string_view name, const auto& a)
+	{
+		const auto b = mpp::matrix<double, mpp::dynamic, 1>{ size, 1.0 };
+
+		const auto product_time = fastest_run([&]() { benchmark_sink = mpp::product(a, b)(0, 0); });
+		const auto solve_time   = fastest_run([&]() { benchmark_sink = mpp::solve(a, b)(0, 0); });
+
+		std::cout << name << " " << size << "x" << size << ": product " << product_time.count() << " ms, solve "
+				  << solve_time.count() << " ms\n";
+	}
+} // namespace
+
+/**
+ * Matrix-vector products and solves of banded systems far too big to be stored densely
+ */
+int main()
+{
+	run("tridiagonal (Thomas)", make_system(mpp::tridiagonal_matrix<double>{ size }));
+	run("pentadiagonal (banded LU)", make_system(mpp::banded_matrix<double>{ size, 2, 2 }));
+
+	return 0;
+}
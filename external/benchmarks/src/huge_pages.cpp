@@ -0,0 +1,75 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#include <mpp/algorithm.hpp>
+#include <mpp/arithmetic.hpp>
+#include <mpp/matrix.hpp>
+#include <mpp/memory.hpp>
+
+#include "../../include/benchmark_utilities.hpp"
+
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+
+namespace
+{
+	template<typename Allocator>
+	void run(std::string_view allocator_name, std::size_t multiply_size, std::size_t transpose_size)
+	{
+		using matrix_t = mpp::matrix<double, mpp::dynamic, mpp::dynamic, Allocator>;
+
+		const auto left  = matrix_t{ multiply_size, multiply_size, 1.5 };
+		const auto right = matrix_t{ multiply_size, multiply_size, 2.0 };
+
+		const auto multiply_time = fastest_run([&]() {
+			const auto result = matrix_t{ left * right };
+			benchmark_sink    = result(0, 0);
+		});
+
+		const auto big = matrix_t{ transpose_size, transpose_size, 1.0 };
+
+		const auto transpose_time = fastest_run([&]() {
+			const auto result = mpp::transpose(big, std::type_identity<matrix_t>{});
+			benchmark_sink    = result(0, 0);
+		});
+
+		std::cout << allocator_name << ": multiply " << multiply_size << "x" << multiply_size << " "
+				  << multiply_time.count() << " ms, transpose " << transpose_size << "x" << transpose_size << " "
+				  << transpose_time.count() << " ms\n";
+	}
+} // namespace
+
+/**
+ * Compares regular and huge page backed buffers (fastest of a few runs each). Huge pages only make a difference
+ * where the kernel has transparent huge pages enabled (/sys/kernel/mm/transparent_hugepage/enabled)
+ */
+int main()
+{
+	constexpr auto multiply_size  = std::size_t{ 768 }; // 4.5 MiB per operand
+	constexpr auto transpose_size = std::size_t{ 4096 }; // 128 MiB
+
+	run<std::allocator<double>>("std::allocator", multiply_size, transpose_size);
+	run<mpp::huge_page_allocator<double>>("mpp::huge_page_allocator", multiply_size, transpose_size);
+
+	return 0;
+}
@@ -0,0 +1,99 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#include <mpp/arithmetic.hpp>
+#include <mpp/matrix.hpp>
+#include <mpp/memory.hpp>
+
+#include "../../include/benchmark_utilities.hpp"
+#include "../../include/custom_allocator.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	// Same amount of elements for every size, so the times show what the allocations cost on top of the work
+	constexpr auto elements_per_run = std::size_t{ 16'000'000 };
+
+	/**
+	 * Short-lived matrices of the same shape: two operands and the result of an expression on them
+	 */
+	template<typename Allocator>
+	void churn(std::size_t size)
+	{
+		using matrix_t = mpp::matrix<double, mpp::dynamic, mpp::dynamic, Allocator>;
+
+		const auto iterations = elements_per_run / (size * size);
+
+		for (auto iteration = std::size_t{}; iteration < iterations; ++iteration)
+		{
+			const auto left   = matrix_t{ size, size, 1.0 };
+			const auto right  = matrix_t{ size, size, 2.0 };
+			const auto result = matrix_t{ left + right };
+
+			benchmark_sink = result(0, 0);
+		}
+	}
+
+	template<typename Allocator>
+	void run(std::string_view allocator_name, std::size_t size)
+	{
+		const auto single_thread_time = fastest_run([&]() { churn<Allocator>(size); });
+
+		const auto thread_count      = std::max(std::thread::hardware_concurrency(), 2U);
+		const auto multi_thread_time = fastest_run([&]() {
+			auto threads = std::vector<std::thread>{};
+
+			for (auto thread = 0U; thread < thread_count; ++thread)
+			{
+				threads.emplace_back([&]() { churn<Allocator>(size); });
+			}
+
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+		});
+
+		std::cout << allocator_name << ": " << size << "x" << size << " " << single_thread_time.count() << " ms, "
+				  << thread_count << " threads " << multi_thread_time.count() << " ms\n";
+	}
+} // namespace
+
+/**
+ * Creates and destroys lots of same-shaped dynamic matrices with different allocators
+ */
+int main()
+{
+	for (const auto size : { std::size_t{ 2 }, std::size_t{ 4 }, std::size_t{ 8 }, std::size_t{ 32 } })
+	{
+		run<std::allocator<double>>("std::allocator", size);
+		run<custom_allocator<double>>("custom_allocator", size);
+		run<mpp::pool_allocator<double>>("mpp::pool_allocator", size);
+	}
+
+	return 0;
+}
@@ -0,0 +1,47 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+
+using benchmark_duration = std::chrono::duration<double, std::milli>;
+
+// Results are written here so the compiler can't throw the work away
+inline volatile double benchmark_sink = 0.0;
+
+/**
+ * Fastest of a few runs, which is the least disturbed by the rest of the system
+ */
+template<typename Callable>
+[[nodiscard]] auto fastest_run(Callable&& callable, int repetitions = 3) -> benchmark_duration
+{
+	auto fastest = benchmark_duration::max();
+
+	for (auto repetition = 0; repetition < repetitions; ++repetition)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		callable();
+		fastest = std::min<benchmark_duration>(fastest, std::chrono::steady_clock::now() - start);
+	}
+
+	return fastest;
+}
@@ -20,12 +20,16 @@
 #include <mpp/utility/comparison.hpp>
 #include <mpp/utility/type.hpp>
 #include <mpp/algorithm.hpp>
+#include <mpp/arithmetic.hpp>
 #include <mpp/matrix.hpp>
 
 #include "../../include/custom_allocator.hpp"
 #include "../../include/test_utilities.hpp"
 
 #include <compare>
+#include <cstddef>
+#include <memory>
+#include <new>
 #include <string_view>
 #include <type_traits>
 #include <utility>
@@ -36,6 +40,39 @@ using namespace mpp;
 
 namespace
 {
+	// Counts the elements constructed without arguments, i.e. value-initialized
+	template<typename Value>
+	struct value_init_counting_allocator : public std::allocator<Value>
+	{
+		template<typename Other>
+		struct rebind
+		{
+			using other = value_init_counting_allocator<Other>;
+		};
+
+		inline static auto value_initialized = std::size_t{};
+
+		value_init_counting_allocator() = default;
+
+		template<typename Other>
+		value_init_counting_allocator(const value_init_counting_allocator<Other>&) noexcept
+		{
+		}
+
+		template<typename Other>
+		void construct(Other* ptr)
+		{
+			++value_initialized;
+			::new (static_cast<void*>(ptr)) Other();
+		}
+
+		template<typename Other, typename... Args>
+		void construct(Other* ptr, Args&&... args)
+		{
+			::new (static_cast<void*>(ptr)) Other(std::forward<Args>(args)...);
+		}
+	};
+
 	template<typename Mats, typename To>
 	void test_det(std::string_view test_name)
 	{
@@ -60,6 +97,22 @@ namespace
 		} | Mats{};
 	}
 
+	template<typename Mats>
+	void test_trps_view(std::string_view test_name)
+	{
+		test(test_name.data()) = [&, test_name]<typename Mat, typename Mat2>(
+									 std::tuple<std::type_identity<Mat>, std::type_identity<Mat2>>) {
+			const auto [mat, mat2] = parse_test(test_name, parse_mat<Mat>, parse_mat<Mat2>);
+
+			cmp_mat_to_expr_like(mat2, transposed(mat));
+			cmp_mat_to_expr_like(mat, transposed(transposed(mat)));
+
+			// The view is consumed directly by the matrix product, compared to the product of the copied transpose
+			cmp_mat_to_expr_like(mat2 * mat, transposed(mat) * mat);
+			cmp_mat_types(Mat2{ transposed(mat) }, mat2);
+		} | Mats{};
+	}
+
 	template<typename Mats>
 	void test_sub(std::string_view test_name, const auto& fn)
 	{
@@ -136,6 +189,11 @@ int main()
 		test_fn<join_mats<dyn_mat<float>, fixed_mat<double, 25, 25>>>("algorithm/trps/25x25.txt", transpose);
 	};
 
+	feature("Transposed view") = []() {
+		test_trps_view<join_mats<all_mats<float, 25, 25>, all_trps_mats<float, 25, 25>>>("algorithm/trps/25x25.txt");
+		test_trps_view<join_mats<all_mats<float, 50, 2>, all_trps_mats<float, 50, 2>>>("algorithm/trps/50x2.txt");
+	};
+
 	feature("Inverse") = []() {
 		test_fn<join_mats<all_mats<double, 0, 0>, all_mats<double, 0, 0>>>("algorithm/inv/0x0.txt", inverse);
 		test_fn<join_mats<all_mats<double, 1, 1>, all_mats<double, 1, 1>>>("algorithm/inv/1x1.txt", inverse);
@@ -186,5 +244,36 @@ int main()
 		test_block<join_mats<dyn_mat<double>, fixed_mat<double, 1, 1>>>("algorithm/block/3x3_1x1_0_0_0_0.txt");
 	};
 
+	feature("Results aren't zero filled before being written") = []() {
+		using counting_mat = matrix<double, dynamic, dynamic, value_init_counting_allocator<double>>;
+		using counter      = value_init_counting_allocator<double>;
+
+		const auto mat = counting_mat{ { 4, 3 }, { 6, 3 } };
+
+		counter::value_initialized = 0;
+
+		const auto transposed_mat = transpose(mat);
+		const auto [l, u]         = lu_decomposition(mat);
+
+		expect(counter::value_initialized == 0_ul);
+		expect(transposed_mat == matrix<double>{ { 4, 6 }, { 3, 3 } });
+		expect(l * u == mat);
+
+		const auto lower  = counting_mat{ { 2, 0, 0 }, { 1, 1, 0 }, { 3, 2, 1 } };
+		const auto upper  = counting_mat{ { 1, 2, 3 }, { 0, 1, 4 }, { 0, 0, 2 } };
+		const auto column = counting_mat{ { 2 }, { 2 }, { 7 } };
+
+		counter::value_initialized = 0;
+
+		const auto inverted   = inverse(lower);
+		const auto forward_x  = forward_substitution(lower, column);
+		const auto backward_x = back_substitution(upper, column);
+
+		expect(counter::value_initialized == 0_ul);
+		expect(inverted * lower == matrix<double>{ { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } });
+		expect(forward_x == matrix<double>{ { 1 }, { 1 }, { 2 } });
+		expect(backward_x == matrix<double>{ { 15.5 }, { -12.0 }, { 3.5 } });
+	};
+
 	return 0;
 }
@@ -0,0 +1,142 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#include <mpp/memory/aligned_configuration.hpp>
+
+namespace mpp
+{
+	template<>
+	struct configuration<override> : public aligned_configuration<cache_line_alignment>
+	{
+	};
+} // namespace mpp
+
+#include <boost/ut.hpp>
+
+#include <mpp/arithmetic.hpp>
+#include <mpp/matrix.hpp>
+#include <mpp/memory.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	[[nodiscard]] auto is_aligned(const void* ptr, std::size_t alignment) -> bool
+	{
+		return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+	}
+} // namespace
+
+int main()
+{
+	using namespace boost::ut::literals;
+	using namespace boost::ut::bdd;
+	using namespace boost::ut;
+
+	when("I check the buffer types through the aligned configuration") = []() {
+		expect(type<typename mpp::matrix<int, 2, 3>::buffer_type> ==
+			   type<mpp::aligned_array<int, 6, mpp::cache_line_alignment>>);
+		expect(type<typename mpp::matrix<int>::buffer_type> ==
+			   type<std::vector<int, mpp::aligned_allocator<int, mpp::cache_line_alignment>>>);
+		expect(constant<mpp::detail::buffer_alignment<mpp::matrix<float, 3, 3>::buffer_type>::value == 64_ul>);
+		expect(constant<mpp::detail::buffer_alignment<mpp::matrix<float>::buffer_type>::value == 64_ul>);
+	};
+
+	scenario("Matrices should be over-aligned") = []() {
+		given("Matrices with different extents") = []() {
+			const auto fully_static    = mpp::matrix<float, 3, 3>{ 1.F };
+			const auto small_static    = mpp::matrix<char, 1, 1>{};
+			const auto fully_dynamic   = mpp::matrix<float>{ 5, 7, 1.F };
+			const auto dynamic_rows    = mpp::matrix<float, mpp::dynamic, 3>{ 4, 1.F };
+			const auto dynamic_columns = mpp::matrix<float, 3, mpp::dynamic>{ 4, 1.F };
+
+			expect(is_aligned(fully_static.data(), mpp::cache_line_alignment));
+			expect(is_aligned(small_static.data(), mpp::cache_line_alignment));
+			expect(is_aligned(fully_dynamic.data(), mpp::cache_line_alignment));
+			expect(is_aligned(dynamic_rows.data(), mpp::cache_line_alignment));
+			expect(is_aligned(dynamic_columns.data(), mpp::cache_line_alignment));
+		};
+
+		given("A matrix evaluated from an expression") = []() {
+			const auto left   = mpp::matrix<double>{ 9, 9, 2.0 };
+			const auto result = mpp::matrix<double>{ left + left * 2.0 };
+
+			expect(is_aligned(result.data(), mpp::cache_line_alignment));
+			expect(result(8, 8) == 6.0_d);
+		};
+
+		given("An empty matrix") = []() {
+			// Null data() of an empty vector must be returned without assuming its alignment
+			const auto empty  = mpp::matrix<double>{};
+			const auto result = mpp::matrix<double>{ empty + empty };
+
+			expect(empty.data() == std::as_const(empty).data());
+			expect(result.size() == 0_ul);
+		};
+	};
+
+	when("I use the aligned allocator directly with page alignment") = []() {
+		auto vec = std::vector<double, mpp::aligned_allocator<double, mpp::page_alignment>>(1000, 1.0);
+
+		expect(is_aligned(vec.data(), mpp::page_alignment));
+
+		vec.resize(100000, 2.0); // Reallocates
+
+		expect(is_aligned(vec.data(), mpp::page_alignment));
+		expect(vec.back() == 2.0_d);
+	};
+
+	scenario("Big buffers from the huge page allocator should be aligned to huge pages") = []() {
+		using huge_matrix = mpp::matrix<double, mpp::dynamic, mpp::dynamic, mpp::huge_page_allocator<double>>;
+
+		given("A matrix bigger than the threshold") = []() {
+			const auto big    = huge_matrix{ 1024, 512, 1.0 }; // 4 MiB
+			const auto result = huge_matrix{ big + big };
+
+			expect(is_aligned(big.data(), mpp::huge_page_size));
+			expect(is_aligned(result.data(), mpp::huge_page_size));
+			expect(result(1023, 511) == 2.0_d);
+		};
+
+		given("A matrix smaller than the threshold") = []() {
+			const auto small = huge_matrix{ 3, 3, 1.0 };
+
+			expect(small(2, 2) == 1.0_d);
+			expect(small.data() != nullptr);
+		};
+
+		when("I use it with a custom threshold") = []() {
+			auto vec = std::vector<float, mpp::huge_page_allocator<float, mpp::page_alignment>>(10, 1.F);
+
+			expect(vec.front() == 1.F);
+
+			vec.resize(1024, 2.F); // 4 KiB, reallocates above the threshold
+
+			expect(is_aligned(vec.data(), mpp::huge_page_size));
+			expect(vec.back() == 2.F);
+		};
+	};
+
+	return 0;
+}
@@ -75,7 +75,43 @@ namespace
 		} | Mats{};
 	}
 
-	template<typename Mats, bool ConstructMat>
+	template<typename Mats>
+	void test_owning_op(std::string_view test_name, const auto& op)
+	{
+		test(test_name) = [&, test_name]<typename T,
+							  typename T2,
+							  typename T3,
+							  std::size_t RowsExtent,
+							  std::size_t RowsExtent2,
+							  std::size_t RowsExtent3,
+							  std::size_t ColumnsExtent,
+							  std::size_t ColumnsExtent2,
+							  std::size_t ColumnsExtent3,
+							  typename Alloc,
+							  typename Alloc2,
+							  typename Alloc3>(
+							  std::tuple<std::type_identity<matrix<T, RowsExtent, ColumnsExtent, Alloc>>,
+								  std::type_identity<matrix<T2, RowsExtent2, ColumnsExtent2, Alloc2>>,
+								  std::type_identity<matrix<T3, RowsExtent3, ColumnsExtent3, Alloc3>>>) {
+			using mat_t  = matrix<T, RowsExtent, ColumnsExtent, Alloc>;
+			using mat2_t = matrix<T2, RowsExtent2, ColumnsExtent2, Alloc2>;
+			using mat3_t = matrix<T3, RowsExtent3, ColumnsExtent3, Alloc3>;
+
+			const auto [mat, mat2, expected_mat] =
+				parse_test(test_name, parse_mat<mat_t>, parse_mat<mat2_t>, parse_mat<mat3_t>);
+
+			// Both operands are temporaries, so the expression object must own them to be usable after returning
+			const auto make_expr = [&]() {
+				return op(mat_t{ mat }, mat2_t{ mat2 });
+			};
+
+			const auto out = make_expr();
+
+			cmp_mat_to_expr_like(out, expected_mat);
+		} | Mats{};
+	}
+
+	template<typename Mats, bool ConstructMat, typename Constant = void>
 	void test_num_op(const std::string& test_name, const auto& op)
 	{
 		test(test_name) = [&, test_name]<typename T,
@@ -91,8 +127,11 @@ namespace
 			using mat_t  = matrix<T, RowsExtent, ColumnsExtent, Alloc>;
 			using mat2_t = matrix<T2, RowsExtent2, ColumnsExtent2, Alloc2>;
 
+			// The constant has the same type as the matrix elements unless it's specified
+			using constant_t = std::conditional_t<std::is_void_v<Constant>, T, Constant>;
+
 			const auto [mat, val, expected_mat] =
-				parse_test(test_name, parse_mat<mat_t>, parse_val<T>, parse_mat<mat2_t>);
+				parse_test(test_name, parse_mat<mat_t>, parse_val<constant_t>, parse_mat<mat2_t>);
 
 			const auto out = [&]() {
 				if constexpr (ConstructMat)
@@ -151,6 +190,39 @@ int main()
 			std::multiplies{});
 	};
 
+	feature("Expressions owning temporary operands") = []() {
+		test_owning_op<join_mats<all_mats<int, 2, 3>, all_mats<int, 2, 3>, all_mats<int, 2, 3>>>(
+			"arithmetic/2x3_add.txt",
+			std::plus{});
+		test_owning_op<join_mats<all_mats<int, 2, 3>, all_mats<int, 3, 1>, all_mats<int, 2, 1>>>(
+			"arithmetic/2x3_3x1_multiply.txt",
+			std::multiplies{});
+		test_owning_op<join_mats<all_mats<int, 2, 3>, all_mats<int, 2, 3>, all_mats<int, 2, 3>>>(
+			"arithmetic/2x3_add.txt",
+			[](auto&& left, auto&& right) {
+				// Nested temporary expression objects are moved into the outer one
+				return (std::forward<decltype(left)>(left) + std::forward<decltype(right)>(right)) * 1;
+			});
+	};
+
+	feature("Mixed value types") = []() {
+		test_op<join_mats<all_mats<float, 2, 3>, all_mats<double, 2, 3>, all_mats<double, 2, 3>>, false>(
+			"arithmetic/2x3_add.txt",
+			std::plus{});
+		test_op<join_mats<all_mats<float, 2, 3>, all_mats<double, 2, 3>, all_mats<float, 2, 3>>, true>(
+			"arithmetic/2x3_subtract.txt",
+			std::minus{});
+		test_op<join_mats<all_mats<int, 2, 3>, all_mats<double, 3, 1>, all_mats<double, 2, 1>>, true>(
+			"arithmetic/2x3_3x1_multiply.txt",
+			std::multiplies{});
+		test_num_op<join_mats<all_mats<int, 2, 3>, all_mats<double, 2, 3>>, false, double>(
+			"arithmetic/2x3_mixed_multiply.txt",
+			std::multiplies{});
+		test_num_op<join_mats<all_mats<int, 2, 3>, all_mats<double, 2, 3>>, true, double>(
+			"arithmetic/2x3_divide.txt",
+			std::divides{});
+	};
+
 	feature("Division (matrix divided with scalar)") = []() {
 		test_num_op<join_mats<all_mats<double, 2, 3>, all_mats<double, 2, 3>>, false>("arithmetic/2x3_divide.txt",
 			std::divides{});
@@ -158,5 +230,22 @@ int main()
 			std::divides{});
 	};
 
+	feature("Compound scalar multiplication and division of owning matrices") = []() {
+		auto dynamic_mat = mpp::matrix<double>{ { 1, 2 }, { 3, 4 } };
+		auto static_mat  = mpp::matrix<double, 2, 2>{ { 1, 2 }, { 3, 4 } };
+
+		dynamic_mat *= 2.0;
+		static_mat *= 2.0;
+
+		expect(dynamic_mat(1, 1) == 8.0_d);
+		expect(static_mat(0, 1) == 4.0_d);
+
+		dynamic_mat /= 4.0;
+		static_mat /= 4.0;
+
+		expect(dynamic_mat(1, 0) == 1.5_d);
+		expect(static_mat(0, 0) == 0.5_d);
+	};
+
 	return 0;
 }
@@ -19,7 +19,11 @@
 
 #include <boost/ut.hpp>
 
+#include <mpp/utility/eval_into.hpp>
+#include <mpp/arithmetic.hpp>
+#include <mpp/algorithm/transpose.hpp>
 #include <mpp/matrix.hpp>
+#include <mpp/utility/comparison.hpp>
 
 #include "../../include/test_utilities.hpp"
 
@@ -112,6 +116,43 @@ namespace
 			cmp_mat_to_expr_like(mat, expected_mat);
 		} | Mats{};
 	}
+
+	template<typename Mats, bool UseEvalInto>
+	void test_assign_expr(std::string_view test_name)
+	{
+		test(test_name.data()) = [&, test_name]<typename T,
+									 typename T2,
+									 std::size_t RowsExtent,
+									 std::size_t RowsExtent2,
+									 std::size_t ColumnsExtent,
+									 std::size_t ColumnsExtent2,
+									 typename Alloc,
+									 typename Alloc2>(
+									 std::tuple<std::type_identity<matrix<T, RowsExtent, ColumnsExtent, Alloc>>,
+										 std::type_identity<matrix<T2, RowsExtent2, ColumnsExtent2, Alloc2>>>) {
+			using mat_t  = matrix<T, RowsExtent, ColumnsExtent, Alloc>;
+			using mat2_t = matrix<T2, RowsExtent2, ColumnsExtent2, Alloc2>;
+
+			auto [mat, mat2, expected_mat] =
+				parse_test(test_name, parse_mat<mat_t>, parse_mat<mat2_t>, parse_mat<mat_t>);
+
+			const auto old_data = mat.data();
+
+			if constexpr (UseEvalInto)
+			{
+				eval_into(mat, mat2 + mat2);
+			}
+			else
+			{
+				mat = mat2 + mat2;
+			}
+
+			cmp_mat_to_expr_like(mat, expected_mat);
+
+			// The result always fits in the existing storage, so it must have been reused
+			expect(mat.data() == old_data);
+		} | Mats{};
+	}
 } // namespace
 
 
@@ -181,5 +222,57 @@ int main()
 			"assignment/2x10_2x3_shrink_dyn_cols_mat.txt");
 	};
 
+	feature("Assigning an expression with same dimensions") = []() {
+		using mats = join_mats<all_mats<int, 2, 3>, all_mats<int, 2, 3>>;
+
+		test_assign_expr<mats, false>("assignment/2x3_same_dims_expr.txt");
+		test_assign_expr<mats, true>("assignment/2x3_same_dims_expr.txt");
+	};
+
+	feature("Shrinking dynamic matrices by expression reuses storage (dynamic matrices only)") = []() {
+		test_assign_expr<join_mats<dyn_mat<int>, dyn_mat<int>>, false>("assignment/10x10_2x3_shrink_dyn_mat_expr.txt");
+		test_assign_expr<join_mats<dyn_rows_mat<int, 3>, dyn_rows_mat<int, 3>>, false>(
+			"assignment/10x3_2x3_shrink_dyn_rows_mat_expr.txt");
+		test_assign_expr<join_mats<dyn_cols_mat<int, 2>, dyn_cols_mat<int, 2>>, true>(
+			"assignment/2x10_2x3_shrink_dyn_cols_mat_expr.txt");
+	};
+
+	feature("Assigning an expression that refers to the matrix being assigned") = []() {
+		given("A product reading other elements of the destination") = []() {
+			auto a       = mpp::matrix<int>{ { 1, 2 }, { 3, 4 } };
+			const auto b = mpp::matrix<int>{ { 0, 1 }, { 1, 0 } };
+
+			a = a * b;
+
+			expect(a == mpp::matrix<int>{ { 2, 1 }, { 4, 3 } });
+
+			a = a * a;
+
+			expect(a == mpp::matrix<int>{ { 8, 5 }, { 20, 13 } });
+		};
+
+		given("A static matrix and a transposed view of it") = []() {
+			auto a = mpp::matrix<int, 2, 2>{ { 1, 2 }, { 3, 4 } };
+
+			a = mpp::transposed(a);
+
+			expect(a == mpp::matrix<int, 2, 2>{ { 1, 3 }, { 2, 4 } });
+
+			mpp::eval_into(a, a * a);
+
+			expect(a == mpp::matrix<int, 2, 2>{ { 7, 15 }, { 10, 22 } });
+		};
+
+		given("An element-wise expression") = []() {
+			auto a          = mpp::matrix<int>{ { 1, 2 }, { 3, 4 } };
+			const auto data = a.data();
+
+			a = a + a * 2;
+
+			expect(a == mpp::matrix<int>{ { 3, 6 }, { 9, 12 } });
+			expect(a.data() == data) << "Element-wise expressions should still be evaluated in place";
+		};
+	};
+
 	return 0;
 }
@@ -0,0 +1,151 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#include <boost/ut.hpp>
+
+#include <mpp/algorithm.hpp>
+#include <mpp/matrix.hpp>
+#include <mpp/utility.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+int main()
+{
+	using namespace boost::ut::literals;
+	using namespace boost::ut::bdd;
+	using namespace boost::ut;
+
+	scenario("Bit matrices should pack their elements into words") = []() {
+		given("A matrix spanning more than one word per row") = []() {
+			auto bits = mpp::bit_matrix<>{ 3, 70 };
+
+			expect(bits.words_per_row() == 2_ul);
+			expect(bits.count() == 0_ul);
+
+			bits.set(0, 0);
+			bits.set(1, 64);
+			bits.set(2, 69);
+
+			expect(bits(0, 0));
+			expect(bits(1, 64));
+			expect(!bits(1, 63));
+			expect(bits.count() == 3_ul);
+
+			when("I complement it") = [&]() {
+				const auto complement = ~bits;
+
+				expect(complement.count() == 207_ul) << "Bits past the last column should stay zero";
+				expect(!complement(2, 69));
+			};
+
+			when("I clear an element") = [&]() {
+				bits.set(1, 64, false);
+
+				expect(!bits(1, 64));
+				expect(bits.count() == 2_ul);
+			};
+		};
+
+		given("A matrix filled with ones") = []() {
+			const auto ones = mpp::bit_matrix<>{ 2, 65, true };
+
+			expect(ones.count() == 130_ul);
+			expect((ones ^ ones).count() == 0_ul);
+		};
+
+		given("Dense matrices") = []() {
+			const auto dense = mpp::matrix<int>{ { 1, 0, 2 }, { 0, 0, 3 } };
+			const auto bits  = mpp::bit_matrix<>{ dense };
+
+			expect(bits == mpp::bit_matrix<>{ { true, false, true }, { false, false, true } });
+			expect(mpp::matrix<int>{ bits } == mpp::matrix<int>{ { 1, 0, 1 }, { 0, 0, 1 } });
+		};
+	};
+
+	scenario("Element-wise operations should work a word at a time") = []() {
+		const auto left  = mpp::bit_matrix<>{ { true, true, false, false } };
+		const auto right = mpp::bit_matrix<>{ { true, false, true, false } };
+
+		expect((left & right) == mpp::bit_matrix<>{ { true, false, false, false } });
+		expect((left | right) == mpp::bit_matrix<>{ { true, true, true, false } });
+		expect((left ^ right) == mpp::bit_matrix<>{ { false, true, true, false } });
+
+		auto accumulated = left;
+		accumulated |= right;
+
+		expect(accumulated == (left | right));
+	};
+
+	scenario("Bit matrix products should use boolean or GF(2) arithmetic") = []() {
+		given("The adjacency matrix of a path graph") = []() {
+			// 0 -> 1 -> 2 -> 3
+			const auto adjacency = mpp::bit_matrix<>{ { false, true, false, false },
+				{ false, false, true, false },
+				{ false, false, false, true },
+				{ false, false, false, false } };
+
+			const auto two_steps = mpp::product(adjacency, adjacency);
+
+			expect(type<std::remove_const_t<decltype(two_steps)>> == type<mpp::bit_matrix<>>);
+			expect(two_steps ==
+				   mpp::bit_matrix<>{ { false, false, true, false },
+					   { false, false, false, true },
+					   { false, false, false, false },
+					   { false, false, false, false } });
+			expect(mpp::transpose(adjacency) == mpp::bit_matrix<>{ mpp::transpose(mpp::matrix<int>{ adjacency }) });
+		};
+
+		given("Matrices wider than a word") = []() {
+			constexpr auto size = std::size_t{ 130 };
+
+			auto left  = mpp::bit_matrix<>{ size, size };
+			auto right = mpp::bit_matrix<>{ size, size };
+
+			for (auto row = std::size_t{}; row < size; ++row)
+			{
+				for (auto column = std::size_t{}; column < size; ++column)
+				{
+					left.set(row, column, (row * 7 + column * 3) % 5 == 0);
+					right.set(row, column, (row + column * 11) % 3 == 0);
+				}
+			}
+
+			const auto dense_product = mpp::matrix<int>{ mpp::matrix<int>{ left } * mpp::matrix<int>{ right } };
+
+			auto boolean_expected = mpp::bit_matrix<>{ size, size };
+			auto gf2_expected     = mpp::bit_matrix<>{ size, size };
+
+			for (auto row = std::size_t{}; row < size; ++row)
+			{
+				for (auto column = std::size_t{}; column < size; ++column)
+				{
+					boolean_expected.set(row, column, dense_product(row, column) != 0);
+					gf2_expected.set(row, column, dense_product(row, column) % 2 != 0);
+				}
+			}
+
+			expect(mpp::product(left, right) == boolean_expected);
+			expect(mpp::product(left, right, mpp::gf2) == gf2_expected);
+		};
+	};
+
+	return 0;
+}
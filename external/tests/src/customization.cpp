@@ -96,6 +96,16 @@ namespace ns
 		return dumb_class2{};
 	}
 
+	[[nodiscard]] constexpr auto tag_invoke(mpp::transposed_t, dumb_class) -> dumb_class2
+	{
+		return dumb_class2{};
+	}
+
+	[[nodiscard]] constexpr auto tag_invoke(mpp::submatrix_t, dumb_class) -> dumb_class2
+	{
+		return dumb_class2{};
+	}
+
 	[[nodiscard]] constexpr auto tag_invoke(mpp::singular_t, dumb_class) -> dumb_class2
 	{
 		return dumb_class2{};
@@ -125,6 +135,26 @@ namespace ns
 	{
 		return dumb_class2{};
 	}
+
+	[[nodiscard]] constexpr auto tag_invoke(mpp::eval_into_t, dumb_class) -> dumb_class2
+	{
+		return dumb_class2{};
+	}
+
+	[[nodiscard]] constexpr auto tag_invoke(mpp::product_t, dumb_class) -> dumb_class2
+	{
+		return dumb_class2{};
+	}
+
+	[[nodiscard]] constexpr auto tag_invoke(mpp::solve_t, dumb_class) -> dumb_class2
+	{
+		return dumb_class2{};
+	}
+
+	[[nodiscard]] constexpr auto tag_invoke(mpp::gram_t, dumb_class) -> dumb_class2
+	{
+		return dumb_class2{};
+	}
 } // namespace ns
 
 template<typename CPO>
@@ -149,11 +179,17 @@ int main()
 		expect(type<invoke_result_t<mpp::determinant_t>> == type<ns::dumb_class2>);
 		expect(type<invoke_result_t<mpp::inverse_t>> == type<ns::dumb_class2>);
 		expect(type<invoke_result_t<mpp::transpose_t>> == type<ns::dumb_class2>);
+		expect(type<invoke_result_t<mpp::transposed_t>> == type<ns::dumb_class2>);
+		expect(type<invoke_result_t<mpp::submatrix_t>> == type<ns::dumb_class2>);
 		expect(type<invoke_result_t<mpp::size_compare_t>> == type<ns::dumb_class2>);
 		expect(type<invoke_result_t<mpp::elements_compare_t>> == type<ns::dumb_class2>);
 		expect(type<invoke_result_t<mpp::lu_decomposition_t>> == type<ns::dumb_class2>);
 		expect(type<invoke_result_t<mpp::forward_substitution_t>> == type<ns::dumb_class2>);
 		expect(type<invoke_result_t<mpp::back_substitution_t>> == type<ns::dumb_class2>);
+		expect(type<invoke_result_t<mpp::eval_into_t>> == type<ns::dumb_class2>);
+		expect(type<invoke_result_t<mpp::product_t>> == type<ns::dumb_class2>);
+		expect(type<invoke_result_t<mpp::solve_t>> == type<ns::dumb_class2>);
+		expect(type<invoke_result_t<mpp::gram_t>> == type<ns::dumb_class2>);
 	};
 
 	when("I check the customized buffer types") = []() {
@@ -173,11 +209,17 @@ int main()
 		expect(boost::ut::constant<std::semiregular<mpp::determinant_t>>);
 		expect(boost::ut::constant<std::semiregular<mpp::inverse_t>>);
 		expect(boost::ut::constant<std::semiregular<mpp::transpose_t>>);
+		expect(boost::ut::constant<std::semiregular<mpp::transposed_t>>);
+		expect(boost::ut::constant<std::semiregular<mpp::submatrix_t>>);
 		expect(boost::ut::constant<std::semiregular<mpp::size_compare_t>>);
 		expect(boost::ut::constant<std::semiregular<mpp::elements_compare_t>>);
 		expect(boost::ut::constant<std::semiregular<mpp::lu_decomposition_t>>);
 		expect(boost::ut::constant<std::semiregular<mpp::forward_substitution_t>>);
 		expect(boost::ut::constant<std::semiregular<mpp::back_substitution_t>>);
+		expect(boost::ut::constant<std::semiregular<mpp::eval_into_t>>);
+		expect(boost::ut::constant<std::semiregular<mpp::product_t>>);
+		expect(boost::ut::constant<std::semiregular<mpp::solve_t>>);
+		expect(boost::ut::constant<std::semiregular<mpp::gram_t>>);
 	};
 
 	return 0;
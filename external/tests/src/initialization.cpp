@@ -23,12 +23,14 @@
 #include "../../include/custom_allocator.hpp"
 #include "../../include/test_utilities.hpp"
 
+#include <algorithm>
 #include <array>
 #include <compare>
 #include <cstddef>
 #include <initializer_list>
 #include <string_view>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 using namespace boost::ut;
@@ -186,5 +188,64 @@ int main()
 			alloc_obj);
 	};
 
+	feature("Uninitialized initialization") = [&]() {
+		test("initialization/2x3_val.txt") =
+			[]<typename T, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Alloc>(
+				std::type_identity<matrix<T, RowsExtent, ColumnsExtent, Alloc>> identity) {
+				// The elements are indeterminate until written, so only the shape can be checked before filling
+				auto out = init_mat_extent_dependent(identity, 2, 3, uninitialized);
+
+				expect(out.rows() == 2_ul);
+				expect(out.columns() == 3_ul);
+
+				std::ranges::fill(out, T{ 2 });
+
+				const auto [expected, expected_rng] = parse_test("initialization/2x3_val.txt",
+					parse_mat_construct_val_arg(identity, T{ 2 }),
+					parse_vec2d<T>);
+
+				cmp_mat_to_rng(out, expected_rng);
+			} |
+			all_mats<double, 2, 3>{};
+	};
+
+	feature("Adopting and releasing buffers") = [&]() {
+		given("A vector produced by other code") = []() {
+			auto vec        = std::vector<double>{ 1, 2, 3, 4, 5, 6 };
+			const auto data = vec.data();
+
+			auto fully_dynamic = matrix<double>{ 2, 3, adopt, std::move(vec) };
+
+			expect(fully_dynamic.data() == data) << "Adopting shouldn't copy the elements";
+			expect(fully_dynamic(1, 2) == 6.0_d);
+
+			auto dynamic_rows = matrix<double, dynamic, 3>{ 2, adopt, fully_dynamic.release() };
+
+			expect(fully_dynamic.empty());
+			expect(fully_dynamic.rows() == 0_ul);
+			expect(fully_dynamic.columns() == 0_ul);
+			expect(dynamic_rows.data() == data);
+
+			auto dynamic_columns = matrix<double, 2, dynamic>{ 3, adopt, dynamic_rows.release() };
+
+			expect(dynamic_rows.rows() == 0_ul);
+			expect(dynamic_columns.data() == data);
+			expect(dynamic_columns(0, 1) == 2.0_d);
+
+			const auto released = dynamic_columns.release();
+
+			expect(released.data() == data) << "Releasing shouldn't copy the elements";
+			expect(dynamic_columns.rows() == 2_ul) << "Static extents are kept";
+			expect(dynamic_columns.columns() == 0_ul);
+		};
+
+		given("An array for a fully static matrix") = []() {
+			auto mat = matrix<int, 2, 2>{ adopt, std::array<int, 4>{ 1, 2, 3, 4 } };
+
+			expect(mat(1, 0) == 3_i);
+			expect(mat.release() == std::array<int, 4>{ 1, 2, 3, 4 });
+		};
+	};
+
 	return 0;
 }
@@ -21,10 +21,82 @@
 #include <boost/ut.hpp>
 
 #include <mpp/matrix.hpp>
+#include <mpp/utility/comparison.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <utility>
 #include <vector>
 
+namespace
+{
+	// Number type counting how many times elements are assigned, i.e. written or moved around in the buffer
+	struct assignment_counted
+	{
+		inline static auto assignments = std::size_t{};
+
+		int value{};
+
+		assignment_counted() = default;
+
+		assignment_counted(int new_value) noexcept : value(new_value) {}
+
+		assignment_counted(const assignment_counted&) = default;
+
+		auto operator=(const assignment_counted& right) noexcept -> assignment_counted&
+		{
+			++assignments;
+			value = right.value;
+
+			return *this;
+		}
+
+		auto operator+=(const assignment_counted& right) noexcept -> assignment_counted&
+		{
+			value += right.value;
+			return *this;
+		}
+
+		auto operator-=(const assignment_counted& right) noexcept -> assignment_counted&
+		{
+			value -= right.value;
+			return *this;
+		}
+
+		auto operator*=(const assignment_counted& right) noexcept -> assignment_counted&
+		{
+			value *= right.value;
+			return *this;
+		}
+
+		auto operator/=(const assignment_counted& right) noexcept -> assignment_counted&
+		{
+			value /= right.value;
+			return *this;
+		}
+
+		friend auto operator+(assignment_counted left, const assignment_counted& right) noexcept -> assignment_counted
+		{
+			return left += right;
+		}
+
+		friend auto operator-(assignment_counted left, const assignment_counted& right) noexcept -> assignment_counted
+		{
+			return left -= right;
+		}
+
+		friend auto operator*(assignment_counted left, const assignment_counted& right) noexcept -> assignment_counted
+		{
+			return left *= right;
+		}
+
+		friend auto operator/(assignment_counted left, const assignment_counted& right) noexcept -> assignment_counted
+		{
+			return left /= right;
+		}
+	};
+} // namespace
+
 int main()
 {
 	// @NOTE: This destructible from rule of five (1/5)
@@ -163,5 +235,123 @@ int main()
 		expect(mat.empty() == "true"_b);
 	} | dyn_mats;
 
+	feature(".append_row()") = [&]<typename Mat>(const Mat&) {
+		auto mat = Mat{};
+
+		mat.append_row(std::vector<int>{ 1, 2, 3 });
+		mat.append_row({ 4, 5, 6 });
+
+		expect(mat == matrix<int, 2, 3>{ range_2d });
+
+		const auto data = mat.data();
+
+		mat.reserve_rows(100);
+		mat.append_rows(range_2d);
+		mat.append_rows(matrix<int, 2, 3>{ range_2d });
+
+		expect(mat.rows() == 6_ul);
+		expect(mat.data() != data) << "Reserving should reallocate once";
+		expect(mat(5, 2) == 6_i);
+
+		const auto reserved = mat.data();
+
+		for (auto index = 0; index < 10; ++index)
+		{
+			mat.append_row(range_2d[0]);
+		}
+
+		expect(mat.data() == reserved) << "Appending within the reserved rows shouldn't reallocate";
+		expect(mat.rows() == 16_ul);
+
+		mat.append_rows(mat);
+
+		expect(mat.rows() == 32_ul);
+		expect(mat(31, 0) == 1_i);
+
+		mat.clear();
+		mat.append_row(range_2d[1]);
+		mat.shrink_to_fit();
+
+		expect(mat == matrix<int, 1, 3>{ { 4, 5, 6 } });
+	} | std::tuple{ matrix<int, dynamic, dynamic>{}, matrix<int, dynamic, 3>{} };
+
+	feature(".reserve_rows() before the column count is known") = [&]() {
+		auto mat = matrix<int>{};
+
+		mat.reserve_rows(10, 3);
+
+		const auto reserved = std::as_const(mat).data();
+
+		for (auto index = 0; index < 10; ++index)
+		{
+			mat.append_row(range_2d[1]);
+		}
+
+		expect(reserved != nullptr);
+		expect(mat.data() == reserved) << "Appending within the reserved rows shouldn't reallocate";
+		expect(mat.rows() == 10_ul);
+	};
+
+	feature(".append_columns()") = [&]<typename Mat>(const Mat&) {
+		auto mat = Mat{};
+
+		mat.append_columns(matrix<int, 2, 2>{ { 1, 2 }, { 4, 5 } });
+
+		expect(mat == matrix<int, 2, 2>{ { 1, 2 }, { 4, 5 } });
+
+		mat.reserve_columns(10);
+
+		const auto reserved = mat.data();
+
+		mat.append_columns(matrix<int, 2, 3>{ range_2d });
+
+		expect(mat.data() == reserved) << "Appending within the reserved columns shouldn't reallocate";
+		expect(mat == matrix<int, 2, 5>{ { 1, 2, 1, 2, 3 }, { 4, 5, 4, 5, 6 } });
+	} | std::tuple{ matrix<int, dynamic, dynamic>{}, matrix<int, 2, dynamic>{} };
+
+	feature(".append_column()") = [&]() {
+		auto mat = matrix<int>{};
+
+		mat.append_column({ 1, 4 });
+		mat.append_column(std::vector<int>{ 2, 5 });
+		mat.append_columns(matrix<int, 2, 1>{ { 3 }, { 6 } });
+
+		expect(mat == matrix<int, 2, 3>{ range_2d });
+		expect(mat(1, 2) == 6_i);
+
+		mat.append_row({ 7, 8, 9 });
+		mat.append_column({ 10, 11, 12 });
+
+		const auto copy = matrix<int>{ mat, mat.get_allocator() };
+
+		expect(mat == matrix<int, 3, 4>{ { 1, 2, 3, 10 }, { 4, 5, 6, 11 }, { 7, 8, 9, 12 } });
+		expect(copy == mat);
+		expect(mat.size() == 12_ul);
+	};
+
+	feature("Appending columns one at a time is amortized O(rows) per column") = []() {
+		using counted_mat = matrix<assignment_counted, 4, dynamic, std::allocator<assignment_counted>>;
+
+		constexpr auto columns = std::size_t{ 256 };
+
+		auto mat = counted_mat{};
+
+		assignment_counted::assignments = 0;
+
+		for (auto column = std::size_t{}; column < columns; ++column)
+		{
+			const auto value = static_cast<int>(column);
+
+			mat.append_column({ value, value, value, -value });
+		}
+
+		// Moving every row on each append would take about 4 * columns^2 / 2 assignments
+		expect(assignment_counted::assignments <= 3 * 4 * columns)
+			<< "Rows should only be moved when their spare columns run out";
+		expect(mat.columns() == columns);
+		expect(mat(3, columns - 1).value == -255_i);
+		expect(std::as_const(mat).data()[2 * columns + 7].value == 7_i) << "Accessing the data packs the rows";
+	};
+
 	return 0;
 }
@@ -0,0 +1,532 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#include <mpp/memory/sbo_buffer.hpp>
+#include <mpp/utility/configuration.hpp>
+
+#include <cstddef>
+
+namespace mpp
+{
+	template<>
+	struct configuration<override> : public configuration<void>
+	{
+		template<typename Value, std::size_t, std::size_t, typename Alloc>
+		using dynamic_buffer = sbo_buffer<Value, 16, Alloc>;
+
+		template<typename Value, std::size_t, std::size_t ColumnsExtent, typename Alloc>
+		using dynamic_rows_buffer = dynamic_buffer<Value, 1, ColumnsExtent, Alloc>;
+
+		template<typename Value, std::size_t RowsExtent, std::size_t, typename Alloc>
+		using dynamic_columns_buffer = dynamic_buffer<Value, RowsExtent, 1, Alloc>;
+	};
+} // namespace mpp
+
+#include <boost/ut.hpp>
+
+#include <mpp/algorithm.hpp>
+#include <mpp/arithmetic.hpp>
+#include <mpp/matrix.hpp>
+#include <mpp/memory.hpp>
+#include <mpp/utility.hpp>
+
+#include "../../include/custom_allocator.hpp"
+#include "../../include/test_utilities.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	template<typename T>
+	[[nodiscard]] auto is_stored_inline(const T& obj, const void* ptr) -> bool
+	{
+		const auto obj_begin = reinterpret_cast<const std::byte*>(&obj);
+		const auto ptr_begin = static_cast<const std::byte*>(ptr);
+
+		return ptr_begin >= obj_begin && ptr_begin < obj_begin + sizeof(T);
+	}
+
+	// Stateful allocator that stays with its container on move assignment
+	template<typename T>
+	struct tagged_allocator
+	{
+		using value_type = T;
+
+		int tag{};
+
+		tagged_allocator() = default;
+
+		explicit tagged_allocator(int new_tag) noexcept : tag(new_tag) {}
+
+		template<typename U>
+		tagged_allocator(const tagged_allocator<U>& right) noexcept : tag(right.tag)
+		{
+		}
+
+		[[nodiscard]] auto allocate(std::size_t n) -> T*
+		{
+			return std::allocator<T>{}.allocate(n);
+		}
+
+		void deallocate(T* ptr, std::size_t n) noexcept
+		{
+			std::allocator<T>{}.deallocate(ptr, n);
+		}
+
+		template<typename U>
+		[[nodiscard]] auto operator==(const tagged_allocator<U>& right) const noexcept -> bool
+		{
+			return tag == right.tag;
+		}
+	};
+} // namespace
+
+int main()
+{
+	using namespace boost::ut::literals;
+	using namespace boost::ut::bdd;
+	using namespace boost::ut;
+
+	when("I check the buffer types through the configuration") = []() {
+		expect(type<typename mpp::matrix<int>::buffer_type> == type<mpp::sbo_buffer<int, 16, std::allocator<int>>>);
+		expect(type<typename mpp::matrix<int, mpp::dynamic, 3>::buffer_type> ==
+			   type<mpp::sbo_buffer<int, 16, std::allocator<int>>>);
+	};
+
+#ifndef _MSC_VER // MSVC ignores [[no_unique_address]]
+	when("I check the footprint of objects with static extents") = []() {
+		using mat_t = mpp::matrix<float, 2, 2>;
+
+		expect(constant<sizeof(mat_t) == 4 * sizeof(float)>) << "Static extents shouldn't be stored";
+		expect(constant<sizeof(std::array<mat_t, 8>) == 32 * sizeof(float)>);
+		expect(constant<sizeof(mpp::matrix_view<float, 2, 2>) == sizeof(float*) + sizeof(std::size_t)>);
+
+		const auto left  = mat_t{ 1.F };
+		const auto right = mat_t{ 2.F };
+
+		expect(sizeof(left + right) == 2 * sizeof(const mat_t*)) << "Expressions should only store their operands";
+		expect(sizeof(left * 2.F) == sizeof(std::pair<const mat_t*, float>));
+		expect(mat_t{ left + right } == mat_t{ 3.F });
+	};
+#endif
+
+	scenario("Small matrices should be stored inline") = []() {
+		given("A tiny fully dynamic matrix") = []() {
+			auto mat = mpp::matrix<double>{ { 1.0, 2.0 }, { 3.0, 4.0 } };
+
+			expect(is_stored_inline(mat, mat.data()));
+
+			then("Results of expressions are also stored inline") = [&]() {
+				const auto result = mpp::matrix<double>{ mat * mat + mat };
+
+				expect(is_stored_inline(result, result.data()));
+				expect(result(1, 1) == 26.0_d);
+			};
+
+			then("Copies and moves keep the elements inline") = [&]() {
+				auto copy  = mat;
+				auto moved = std::move(copy);
+
+				expect(is_stored_inline(moved, moved.data()));
+				expect(moved(1, 0) == 3.0_d);
+			};
+		};
+
+		given("A matrix that outgrows the inline storage") = []() {
+			auto mat = mpp::matrix<int>{ 5, 5, 7 };
+
+			expect(!is_stored_inline(mat, mat.data()));
+
+			const auto data = mat.data();
+			auto moved      = std::move(mat);
+
+			expect(moved.data() == data) << "Moving heap storage shouldn't copy the elements";
+			expect(moved(4, 4) == 7_i);
+
+			auto small = mpp::matrix<int>{ { 1, 2 } };
+			swap(small, moved);
+
+			expect(small.rows() == 5_ul);
+			expect(small(4, 4) == 7_i);
+			expect(moved(0, 1) == 2_i);
+		};
+	};
+
+	scenario("sbo_buffer should grow and shrink like a vector") = []() {
+		auto buf = mpp::sbo_buffer<int, 4, custom_allocator<int>>{};
+
+		for (auto index = 0; index < 4; ++index)
+		{
+			buf.push_back(index);
+		}
+
+		expect(!buf.is_heap_allocated());
+		expect(buf.capacity() == 4_ul);
+
+		buf.push_back(4);
+
+		expect(buf.is_heap_allocated());
+		expect(buf.size() == 5_ul);
+		expect(buf.back() == 4_i);
+
+		buf.resize(3);
+		buf.shrink_to_fit();
+
+		expect(!buf.is_heap_allocated());
+		expect(buf.size() == 3_ul);
+		expect(buf[0] == 0_i && buf[2] == 2_i);
+
+		buf.resize(20, 9);
+
+		expect(buf.is_heap_allocated());
+		expect(buf[19] == 9_i);
+	};
+
+	scenario("sbo_buffer should accept its own elements while growing") = []() {
+		given("A full inline buffer of doubles") = []() {
+			auto buf = mpp::sbo_buffer<double, 2>{};
+			buf.push_back(1.0);
+			buf.push_back(2.0);
+
+			buf.push_back(buf[0]);
+			buf.emplace_back(buf.back());
+
+			expect(buf.is_heap_allocated());
+			expect(buf.size() == 4_ul);
+			expect(buf[2] == 1.0_d && buf[3] == 1.0_d);
+
+			buf.resize(40, buf[1]);
+
+			expect(buf[39] == 2.0_d);
+		};
+
+		given("A full inline buffer of strings") = []() {
+			auto buf = mpp::sbo_buffer<std::string, 2>{};
+			buf.push_back("a string too long for the small string optimization");
+			buf.push_back("b");
+
+			buf.push_back(buf[0]);
+
+			expect(buf.is_heap_allocated());
+			expect(buf[2] == buf[0]);
+			expect(buf[2].size() == 51_ul);
+		};
+	};
+
+	scenario("sbo_buffer move assignment should respect the allocator") = []() {
+		using equal_buffer_t  = mpp::sbo_buffer<int, 2>;
+		using tagged_buffer_t = mpp::sbo_buffer<int, 2, tagged_allocator<int>>;
+
+		expect(constant<std::is_nothrow_move_assignable_v<equal_buffer_t>>);
+		expect(constant<!std::is_nothrow_move_assignable_v<tagged_buffer_t>>)
+			<< "Unequal allocators need a fresh allocation";
+
+		auto left  = tagged_buffer_t{ tagged_allocator<int>{ 1 } };
+		auto right = tagged_buffer_t{ 5, 3, tagged_allocator<int>{ 2 } };
+
+		left = std::move(right);
+
+		expect(left.get_allocator().tag == 1_i) << "The allocator doesn't propagate on move assignment";
+		expect(left.size() == 5_ul && left[4] == 3_i);
+	};
+
+	scenario("Workspaces should reuse their memory") = []() {
+		given("A workspace with a small initial block") = []() {
+			auto arena = mpp::workspace{ 64 };
+
+			{
+				const auto scope = mpp::workspace_scope{ arena };
+
+				const auto first  = arena.allocate(48, 8);
+				const auto second = arena.allocate(100, 64);
+
+				expect(reinterpret_cast<std::uintptr_t>(second) % 64 == 0_ul);
+				expect(first != second);
+				expect(arena.block_count() == 2_ul);
+			}
+
+			then("The blocks are merged once everything is released") = [&]() {
+				expect(arena.block_count() == 1_ul);
+				expect(noexcept(arena.reset())) << "Scopes reset the workspace from their destructor";
+
+				const auto capacity = arena.capacity();
+
+				{
+					const auto scope = mpp::workspace_scope{ arena };
+					using vec_t = std::vector<int, mpp::workspace_allocator<int>>;
+
+					const auto vec = vec_t(10, 1, mpp::workspace_allocator<int>{ arena });
+
+					expect(vec.back() == 1_i);
+				}
+
+				expect(arena.capacity() == capacity);
+			};
+		};
+
+		given("Repeated inversions with the same workspace") = []() {
+			auto arena     = mpp::workspace{};
+			const auto mat = mpp::matrix<double>{ { 2, 0, 0, 1 }, { 0, 3, 0, 0 }, { 0, 0, 4, 0 }, { 1, 0, 0, 5 } };
+
+			const auto expected = mpp::inverse(mat);
+			const auto first    = mpp::inverse(mat, arena);
+			const auto capacity = arena.capacity();
+			const auto second   = mpp::inverse(mat, arena);
+
+			expect(arena.capacity() == capacity) << "Temporaries should be served from the existing workspace";
+			expect(cmp_mat_to_expr_like_impl(first, expected));
+			expect(cmp_mat_to_expr_like_impl(second, expected));
+			expect(mpp::determinant(mat, arena) == mpp::determinant(mat));
+			expect(mpp::singular(mat, arena) == mpp::singular(mat));
+			expect(arena.capacity() == capacity);
+		};
+
+		given("A workspace that has grown past what it should retain") = []() {
+			auto arena = mpp::workspace{};
+
+			arena.set_retained_capacity(256);
+
+			{
+				const auto scope = mpp::workspace_scope{ arena };
+
+				[[maybe_unused]] const auto allocation = arena.allocate(1024, 8);
+			}
+
+			expect(arena.capacity() == 0_ul) << "Blocks past the retained capacity should be freed";
+
+			{
+				const auto scope = mpp::workspace_scope{ arena };
+
+				[[maybe_unused]] const auto allocation = arena.allocate(128, 8);
+			}
+
+			expect(arena.capacity() > 0_ul) << "Blocks within the retained capacity should be kept";
+
+			arena.shrink_to(64);
+
+			expect(arena.capacity() == 64_ul);
+
+			arena.release();
+
+			expect(arena.capacity() == 0_ul);
+			expect(arena.block_count() == 0_ul);
+			expect(mpp::thread_workspace().retained_capacity() == mpp::thread_workspace_retained_capacity);
+		};
+	};
+
+	scenario("Default initializing allocators should only skip the value initialization") = []() {
+		given("A vector using a default initializing allocator") = []() {
+			using vec_t = std::vector<int, mpp::default_init_allocator<int>>;
+
+			auto vec = vec_t(4, 7);
+
+			vec.resize(8);
+			std::fill(vec.begin() + 4, vec.end(), 3);
+
+			then("Elements constructed with a value still get it") = [&]() {
+				expect(vec.size() == 8_ul);
+				expect(vec[0] == 7_i);
+				expect(vec[3] == 7_i);
+				expect(vec[7] == 3_i);
+			};
+		};
+
+		given("A workspace allocator wrapped by a default initializing allocator") = []() {
+			auto arena  = mpp::workspace{};
+			using vec_t = std::vector<double, mpp::default_init_allocator<double, mpp::workspace_allocator<double>>>;
+
+			const auto scope = mpp::workspace_scope{ arena };
+			auto vec         = vec_t(vec_t::allocator_type{ arena });
+
+			vec.resize(10);
+
+			expect(vec.get_allocator() == vec_t::allocator_type{ arena });
+			expect(arena.capacity() >= 10 * sizeof(double));
+		};
+
+		given("An uninitialized matrix with a default initializing allocator") = []() {
+			auto mat = mpp::matrix<double, mpp::dynamic, mpp::dynamic, mpp::default_init_allocator<double>>{ 3,
+				2,
+				mpp::uninitialized };
+
+			std::ranges::fill(mat, 1.5);
+
+			expect(mat.rows() == 3_ul);
+			expect(mat.columns() == 2_ul);
+			expect(mpp::transpose(mat) == mpp::matrix<double, 2, 3>{ 1.5 });
+		};
+	};
+
+	scenario("Pool allocators should reuse freed blocks of the same size class") = []() {
+		given("The size classes") = []() {
+			for (auto bytes = std::size_t{ 1 }; bytes <= mpp::pool_resource::max_pooled_bytes; bytes += bytes / 7 + 1)
+			{
+				const auto index = mpp::pool_resource::class_index(bytes);
+
+				expect(index < mpp::pool_resource::class_count);
+				expect(mpp::pool_resource::class_size(index) >= bytes);
+				if (index > 0)
+				{
+					expect(mpp::pool_resource::class_size(index - 1) < bytes);
+				}
+			}
+
+			expect(mpp::pool_resource::class_index(mpp::pool_resource::max_pooled_bytes) + 1 ==
+				   mpp::pool_resource::class_count);
+		};
+
+		given("Matrices created and destroyed one after the other") = []() {
+			using pooled_matrix = mpp::matrix<double, mpp::dynamic, mpp::dynamic, mpp::pool_allocator<double>>;
+
+			const auto* first_data = static_cast<const double*>(nullptr);
+
+			{
+				const auto mat = pooled_matrix{ 8, 8, 1.0 };
+				first_data     = mat.data();
+
+				expect(reinterpret_cast<std::uintptr_t>(mat.data()) % mpp::cache_line_alignment == 0_ul);
+			}
+
+			const auto cached = mpp::thread_pool_resource().cached_blocks();
+
+			expect(cached >= 1_ul);
+
+			const auto mat = pooled_matrix{ 8, 8, 2.0 };
+
+			expect(mat.data() == first_data) << "The freed block should be reused";
+			expect(mpp::thread_pool_resource().cached_blocks() == cached - 1);
+			expect(mpp::transpose(mat) == mpp::matrix<double, 8, 8>{ 2.0 });
+		};
+
+		given("A block freed by another thread") = []() {
+			auto vec = std::vector<int, mpp::pool_allocator<int>>(100, 1);
+
+			std::thread([moved = std::move(vec)]() mutable { moved = {}; }).join();
+
+			expect(vec.empty());
+		};
+
+		mpp::thread_pool_resource().release();
+
+		expect(mpp::thread_pool_resource().cached_blocks() == 0_ul);
+	};
+
+#ifdef MPP_HAS_MAPPED_FILE
+	scenario("Mapped matrices should read and write their file in place") = []() {
+		const auto path = std::filesystem::temp_directory_path() / "mpp_mapped_matrix_test.bin";
+
+		given("A file holding a header followed by a 2x3 matrix") = [&]() {
+			{
+				const auto header = std::uint64_t{ 42 };
+				const auto values = std::vector<double>{ 1, 2, 3, 4, 5, 6 };
+
+				auto file = std::ofstream(path, std::ios::binary | std::ios::trunc);
+				file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+				file.write(reinterpret_cast<const char*>(values.data()),
+					static_cast<std::streamsize>(values.size() * sizeof(double)));
+			}
+
+			const auto mapped = mpp::mapped_matrix<const double>{ path, 2, 3, sizeof(std::uint64_t) };
+
+			expect(mapped.rows() == 2_ul);
+			expect(mapped.columns() == 3_ul);
+			expect(mapped == mpp::matrix<double, 2, 3>{ { 1, 2, 3 }, { 4, 5, 6 } });
+			expect(mpp::transpose(mapped.view()) == mpp::matrix<double, 3, 2>{ { 1, 4 }, { 2, 5 }, { 3, 6 } });
+
+			then("Asking for more elements than the file holds throws") = [&]() {
+				expect(throws<std::length_error>([&]() {
+					[[maybe_unused]] const auto too_big = mpp::mapped_matrix<const double>{ path, 3, 3 };
+				}));
+			};
+		};
+
+		given("A mapped matrix created from scratch") = [&]() {
+			{
+				auto mapped = mpp::mapped_matrix<double>::create(path, 2, 2);
+
+				expect(mapped == mpp::matrix<double, 2, 2>{ 0.0 }) << "New files should be zero filled";
+
+				mapped = mpp::matrix<double, 2, 2>{ { 1, 2 }, { 3, 4 } };
+				mapped(1, 1) = 10;
+				mapped.flush();
+			}
+
+			then("The writes end up in the file") = [&]() {
+				expect(std::filesystem::file_size(path) == 4 * sizeof(double));
+
+				auto values = std::vector<double>(4);
+				auto file   = std::ifstream(path, std::ios::binary);
+				file.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(4 * sizeof(double)));
+
+				expect(values == std::vector<double>{ 1, 2, 3, 10 });
+			};
+
+			then("Assigning an expression reading other elements of the matrix gives the right result") = [&]() {
+				auto mapped = mpp::mapped_matrix<double>{ path, 2, 2 };
+
+				mapped = mpp::transposed(mapped);
+
+				expect(mapped == mpp::matrix<double, 2, 2>{ { 1, 3 }, { 2, 10 } });
+
+				mapped = mapped * mapped;
+
+				expect(mapped == mpp::matrix<double, 2, 2>{ { 7, 33 }, { 22, 106 } });
+			};
+		};
+
+		given("Dimensions whose product overflows") = [&]() {
+			constexpr auto huge = std::size_t{ 1 } << (std::numeric_limits<std::size_t>::digits / 2 + 1);
+
+			expect(throws<std::length_error>([&]() {
+				[[maybe_unused]] const auto overflowing = mpp::mapped_matrix<double>::create(path, huge, huge);
+			}));
+			expect(throws<std::length_error>([&]() {
+				[[maybe_unused]] const auto overflowing = mpp::mapped_matrix<const double>{ path, huge, huge };
+			}));
+			expect(throws<std::length_error>([&]() {
+				[[maybe_unused]] const auto too_many_bytes =
+					mpp::mapped_matrix<double>::create(path, 1, (std::numeric_limits<std::size_t>::max)() / 4);
+			}));
+		};
+
+		given("A missing file") = [&]() {
+			expect(throws<std::system_error>([&]() {
+				[[maybe_unused]] const auto missing = mpp::mapped_matrix<double>{ path / "missing", 1, 1 };
+			}));
+		};
+
+		std::filesystem::remove(path);
+	};
+#endif
+
+	return 0;
+}
@@ -0,0 +1,197 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#include <mpp/memory/cow_buffer.hpp>
+#include <mpp/utility/configuration.hpp>
+
+#include <cstddef>
+
+namespace mpp
+{
+	template<>
+	struct configuration<override> : public configuration<void>
+	{
+		template<typename Value, std::size_t, std::size_t, typename Alloc>
+		using dynamic_buffer = cow_buffer<Value, Alloc>;
+
+		template<typename Value, std::size_t, std::size_t ColumnsExtent, typename Alloc>
+		using dynamic_rows_buffer = dynamic_buffer<Value, 1, ColumnsExtent, Alloc>;
+
+		template<typename Value, std::size_t RowsExtent, std::size_t, typename Alloc>
+		using dynamic_columns_buffer = dynamic_buffer<Value, RowsExtent, 1, Alloc>;
+	};
+} // namespace mpp
+
+#include <boost/ut.hpp>
+
+#include <mpp/algorithm.hpp>
+#include <mpp/arithmetic.hpp>
+#include <mpp/matrix.hpp>
+#include <mpp/utility.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+int main()
+{
+	using namespace boost::ut::literals;
+	using namespace boost::ut::bdd;
+	using namespace boost::ut;
+
+	when("I check the buffer types through the configuration") = []() {
+		expect(type<typename mpp::matrix<int>::buffer_type> == type<mpp::cow_buffer<int, std::allocator<int>>>);
+		expect(type<typename mpp::matrix<int, 2, mpp::dynamic>::buffer_type> ==
+			   type<mpp::cow_buffer<int, std::allocator<int>>>);
+	};
+
+	scenario("Copies should share their elements until one of them is modified") = []() {
+		given("A dynamic matrix and a copy of it") = []() {
+			auto original   = mpp::matrix<double>{ 3, 3, 1.0 };
+			const auto copy = original;
+
+			expect(std::as_const(original).data() == copy.data()) << "Copying shouldn't copy the elements";
+			expect(copy == mpp::matrix<double, 3, 3>{ 1.0 });
+
+			when("I only read the copy") = [&]() {
+				const auto sum = copy + copy;
+
+				expect(mpp::matrix<double>{ sum } == mpp::matrix<double, 3, 3>{ 2.0 });
+				expect(std::as_const(original).data() == copy.data());
+			};
+
+			when("I modify the original") = [&]() {
+				original(1, 1) = 5.0;
+
+				expect(std::as_const(original).data() != copy.data()) << "Modifying should detach the original";
+				expect(original(1, 1) == 5.0_d);
+				expect(copy(1, 1) == 1.0_d) << "The copy should keep the old elements";
+			};
+		};
+
+		given("Several copies of the same matrix") = []() {
+			const auto weights = mpp::matrix<int, mpp::dynamic, 2>{ 2, 7 };
+			auto copies        = std::vector<mpp::matrix<int, mpp::dynamic, 2>>(4, weights);
+
+			expect(std::ranges::all_of(copies, [&](const auto& copy) { return copy.data() == weights.data(); }));
+
+			copies[0] = mpp::matrix<int, 2, 2>{ { 1, 2 }, { 3, 4 } };
+
+			expect(copies[0] == mpp::matrix<int, 2, 2>{ { 1, 2 }, { 3, 4 } });
+			expect(weights == mpp::matrix<int, 2, 2>{ 7 });
+			expect(std::as_const(copies[1]).data() == weights.data());
+		};
+
+		given("A matrix that isn't shared") = []() {
+			auto mat        = mpp::matrix<int>{ 2, 2, 3 };
+			const auto data = std::as_const(mat).data();
+
+			mat(0, 0) = 4;
+
+			expect(mat.data() == data) << "Unshared elements should be modified in place";
+			expect(mat(0, 0) == 4_i);
+		};
+	};
+
+	scenario("Copies made after handing out a reference to the elements should get their own elements") = []() {
+		given("A reference to an element") = []() {
+			auto original   = mpp::matrix<int>{ 2, 2, 1 };
+			auto& element   = original(0, 0);
+			const auto copy = original;
+
+			element = 5;
+
+			expect(copy(0, 0) == 1_i) << "Writing through the reference shouldn't modify the copy";
+			expect(original(0, 0) == 5_i);
+		};
+
+		given("A view of the matrix") = []() {
+			auto original   = mpp::matrix<int>{ 2, 2, 1 };
+			auto view       = mpp::matrix_view{ original };
+			const auto copy = original;
+
+			view(1, 1) = 5;
+
+			expect(copy(1, 1) == 1_i) << "Writing through the view shouldn't modify the copy";
+			expect(original(1, 1) == 5_i);
+		};
+
+		given("A matrix that has been cleared since") = []() {
+			auto original = mpp::matrix<int>{ 2, 2, 1 };
+
+			original(0, 0) = 2;
+			original.clear();
+			original.append_row({ 1, 2 });
+
+			const auto copy = original;
+
+			expect(std::as_const(original).data() == copy.data()) << "Clearing should make them shareable";
+		};
+	};
+
+	scenario("cow_buffer should behave like a vector") = []() {
+		auto buf = mpp::cow_buffer<int>{};
+
+		expect(buf.empty());
+		expect(std::as_const(buf).data() == nullptr);
+
+		buf.push_back(1);
+		buf.push_back(2);
+
+		auto copy = buf;
+
+		expect(copy.is_shared());
+
+		copy.resize(4, 9);
+
+		expect(!buf.is_shared());
+		expect(buf.size() == 2_ul);
+		expect(copy.size() == 4_ul);
+		expect(copy.back() == 9_i);
+
+		copy.clear();
+
+		expect(copy.empty());
+		expect(copy.capacity() >= 4_ul) << "Clearing unshared elements should keep the capacity";
+
+		buf.front() = 3;
+
+		const auto unshared = buf;
+
+		expect(!buf.is_shareable());
+		expect(!buf.is_shared()) << "Copies of a buffer that handed out a reference shouldn't share its elements";
+		expect(unshared.is_shareable());
+		expect(unshared.front() == 3_i);
+
+		buf.share();
+
+		const auto shared_again = buf;
+
+		expect(buf.is_shareable());
+		expect(buf.is_shared()) << "Copies should share the elements again once the buffer is made shareable";
+		expect(std::as_const(buf).data() == shared_again.data());
+
+		buf.front() = 4;
+
+		expect(shared_again.front() == 3_i) << "Modifying a shared buffer should still copy its elements";
+	};
+
+	return 0;
+}
@@ -0,0 +1,134 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#include <boost/ut.hpp>
+
+#include <mpp/algorithm.hpp>
+#include <mpp/matrix.hpp>
+#include <mpp/utility.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+int main()
+{
+	using namespace boost::ut::literals;
+	using namespace boost::ut::bdd;
+	using namespace boost::ut;
+
+	scenario("CSR matrices should be built from triplets and dense matrices") = []() {
+		given("Unordered triplets with a duplicate") = []() {
+			const auto triplets = std::vector<mpp::triplet<int>>{ { 2, 1, 5 }, { 0, 2, 3 }, { 0, 0, 1 }, { 2, 1, 2 } };
+			const auto sparse   = mpp::csr_matrix<int>{ 3, 4, triplets };
+
+			expect(sparse.rows() == 3_ul);
+			expect(sparse.columns() == 4_ul);
+			expect(sparse.non_zeros() == 3_ul) << "Duplicates should be summed";
+			expect(std::ranges::equal(sparse.row_offsets(), std::vector<std::size_t>{ 0, 2, 2, 3 }));
+			expect(std::ranges::equal(sparse.column_indices(), std::vector<std::size_t>{ 0, 2, 1 }));
+			expect(std::ranges::equal(sparse.values(), std::vector<int>{ 1, 3, 7 }));
+
+			expect(sparse(2, 1) == 7_i);
+			expect(sparse(1, 1) == 0_i);
+			expect(sparse(0, 3) == 0_i);
+
+			when("I convert it to a dense matrix") = [&]() {
+				const auto dense = mpp::matrix<int>{ sparse };
+
+				expect(dense == mpp::matrix<int, 3, 4>{ { 1, 0, 3, 0 }, { 0, 0, 0, 0 }, { 0, 7, 0, 0 } });
+
+				then("Compressing it again should give back the same elements") = [&]() {
+					const auto compressed = mpp::csr_matrix<int>{ dense };
+
+					expect(std::ranges::equal(compressed.row_offsets(), sparse.row_offsets()));
+					expect(std::ranges::equal(compressed.column_indices(), sparse.column_indices()));
+					expect(std::ranges::equal(compressed.values(), sparse.values()));
+				};
+			};
+		};
+
+		given("A matrix without any non-zero elements") = []() {
+			const auto sparse = mpp::csr_matrix<double>{ 2, 2 };
+
+			expect(sparse.non_zeros() == 0_ul);
+			expect(mpp::matrix<double>{ sparse } == mpp::matrix<double, 2, 2>{});
+		};
+	};
+
+	scenario("Products with CSR matrices should only use the non-zero elements") = []() {
+		const auto dense_left = mpp::matrix<double>{ { 4, 0, 0, 1 }, { 0, 0, 0, 0 }, { 2, 3, 0, 0 }, { 0, 0, 0, 5 } };
+		const auto sparse     = mpp::csr_matrix<double>{ dense_left };
+
+		given("A dense vector") = [&]() {
+			const auto vector = mpp::matrix<double, mpp::dynamic, 1>{ { 1 }, { 2 }, { 3 }, { 4 } };
+			const auto result = mpp::product(sparse, vector);
+
+			expect(type<std::remove_const_t<decltype(result)>> == type<mpp::matrix<double, mpp::dynamic, 1>>);
+			expect(result == mpp::matrix<double>{ dense_left * vector });
+		};
+
+		given("A dense matrix") = [&]() {
+			const auto right    = mpp::matrix<double>{ { 1, 2 }, { 3, 4 }, { 5, 6 }, { 7, 8 } };
+			const auto expected = mpp::matrix<double>{ dense_left * right };
+
+			expect(mpp::product(sparse, right) == expected);
+			expect(mpp::product(sparse, right, mpp::thread_count{ 3 }) == expected);
+			expect(mpp::product(sparse, right, mpp::thread_count{ 16 }) == expected) << "Threads are capped by rows";
+			expect(mpp::product(dense_left, right) == expected) << "Dense operands should use the dense product";
+		};
+
+		given("A bigger banded matrix split across threads") = []() {
+			constexpr auto size = std::size_t{ 200 };
+
+			auto triplets = std::vector<mpp::triplet<float>>{};
+
+			for (auto row = std::size_t{}; row < size; ++row)
+			{
+				triplets.push_back({ row, row, 2.0F });
+
+				if (row + 1 < size)
+				{
+					triplets.push_back({ row, row + 1, -1.0F });
+					triplets.push_back({ row + 1, row, -1.0F });
+				}
+			}
+
+			const auto sparse_banded = mpp::csr_matrix<float>{ size, size, triplets };
+			const auto right         = mpp::matrix<float>{ size, 3, 1.0F };
+			const auto result        = mpp::product(sparse_banded, right, mpp::thread_count{ 4 });
+
+			expect(result == mpp::matrix<float>{ mpp::matrix<float>{ sparse_banded } * right });
+		};
+	};
+
+	scenario("Transposing a CSR matrix should keep it sparse") = []() {
+		const auto sparse     = mpp::csr_matrix<int>{ 2, 3, { { 0, 2, 1 }, { 1, 0, 2 }, { 1, 2, 3 } } };
+		const auto transposed = mpp::transpose(sparse);
+
+		expect(type<std::remove_const_t<decltype(transposed)>> == type<mpp::csr_matrix<int>>);
+		expect(transposed.rows() == 3_ul);
+		expect(transposed.columns() == 2_ul);
+		expect(mpp::matrix<int>{ transposed } == mpp::transpose(mpp::matrix<int>{ sparse }));
+	};
+
+	return 0;
+}
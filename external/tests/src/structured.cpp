@@ -0,0 +1,320 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#include <boost/ut.hpp>
+
+#include <mpp/algorithm.hpp>
+#include <mpp/arithmetic.hpp>
+#include <mpp/matrix.hpp>
+#include <mpp/utility.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+	[[nodiscard]] auto close_to(const auto& left, const auto& right, double tolerance = 1e-9) -> bool
+	{
+		if (left.rows() != right.rows() || left.columns() != right.columns())
+		{
+			return false;
+		}
+
+		for (auto row = std::size_t{}; row < left.rows(); ++row)
+		{
+			for (auto column = std::size_t{}; column < left.columns(); ++column)
+			{
+				if (std::abs(static_cast<double>(left(row, column)) - static_cast<double>(right(row, column))) >
+					tolerance)
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Dense expression that counts how many of its elements have been read, so tests can tell which product kernel
+	 * was used
+	 */
+	class counted_reads : public mpp::detail::expr_base<counted_reads, double, mpp::dynamic, mpp::dynamic>
+	{
+		const mpp::matrix<double>* matrix_;
+		std::size_t* reads_;
+
+	public:
+		using value_type = double;
+		using size_type  = std::size_t;
+
+		counted_reads(const mpp::matrix<double>& matrix, std::size_t& reads) : matrix_(&matrix), reads_(&reads) {}
+
+		[[nodiscard]] auto rows() const noexcept -> std::size_t
+		{
+			return matrix_->rows();
+		}
+
+		[[nodiscard]] auto columns() const noexcept -> std::size_t
+		{
+			return matrix_->columns();
+		}
+
+		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) const -> double
+		{
+			++*reads_;
+
+			return (*matrix_)(row_index, col_index);
+		}
+	};
+} // namespace
+
+int main()
+{
+	using namespace boost::ut::literals;
+	using namespace boost::ut::bdd;
+	using namespace boost::ut;
+
+	scenario("Banded matrices should only store their band") = []() {
+		given("A dense matrix with a band of one diagonal below and two above") = []() {
+			const auto dense = mpp::matrix<int>{ { 1, 2, 3, 0 }, { 4, 5, 6, 7 }, { 0, 8, 9, 1 }, { 0, 0, 2, 3 } };
+			auto banded      = mpp::banded_matrix<int>{ dense, 1, 2 };
+
+			expect(banded.rows() == 4_ul);
+			expect(banded.lower_bandwidth() == 1_ul);
+			expect(banded.upper_bandwidth() == 2_ul);
+			expect(banded.row_width() == 4_ul);
+			expect(banded(3, 0) == 0_i);
+			expect(banded(1, 3) == 7_i);
+			expect(!banded.in_band(0, 3));
+			expect(mpp::matrix<int>{ banded } == dense);
+
+			when("I modify an element of the band") = [&]() {
+				banded.band(2, 3) = 10;
+
+				expect(banded(2, 3) == 10_i);
+			};
+		};
+
+		given("A tridiagonal matrix") = []() {
+			const auto tridiagonal = mpp::tridiagonal_matrix<double>{ 5, 1.0 };
+
+			expect(tridiagonal.lower_bandwidth() == 1_ul);
+			expect(tridiagonal.upper_bandwidth() == 1_ul);
+			expect(tridiagonal(0, 0) == 1.0_d);
+			expect(tridiagonal(4, 3) == 1.0_d);
+			expect(tridiagonal(0, 2) == 0.0_d);
+
+#ifndef _MSC_VER // MSVC ignores [[no_unique_address]]
+			expect(sizeof(tridiagonal) == sizeof(mpp::banded_matrix<double>) - 2 * sizeof(std::size_t))
+				<< "Static bandwidths shouldn't be stored";
+#endif
+		};
+	};
+
+	scenario("Products with banded matrices should match the dense product") = []() {
+		const auto dense  = mpp::matrix<double>{ { 2, 1, 0 }, { 1, 2, 1 }, { 0, 1, 2 } };
+		const auto banded = mpp::tridiagonal_matrix<double>{ dense };
+		const auto vector = mpp::matrix<double, mpp::dynamic, 1>{ { 1 }, { 2 }, { 3 } };
+		const auto right  = mpp::matrix<double>{ { 1, 2 }, { 3, 4 }, { 5, 6 } };
+
+		expect(mpp::product(banded, vector) == mpp::matrix<double>{ dense * vector });
+		expect(mpp::product(banded, right) == mpp::matrix<double>{ dense * right });
+	};
+
+	scenario("Banded systems should be solved without touching elements outside the band") = []() {
+		given("A diagonally dominant tridiagonal system") = []() {
+			constexpr auto size = std::size_t{ 1000 };
+
+			auto a = mpp::tridiagonal_matrix<double>{ size };
+
+			for (auto row = std::size_t{}; row < size; ++row)
+			{
+				a.band(row, row) = 4.0;
+
+				if (row + 1 < size)
+				{
+					a.band(row, row + 1) = -1.0;
+					a.band(row + 1, row) = -2.0;
+				}
+			}
+
+			auto expected = mpp::matrix<double, mpp::dynamic, 1>{ size, 1.0 };
+
+			for (auto row = std::size_t{}; row < size; ++row)
+			{
+				expected(row, 0) = static_cast<double>(row % 7);
+			}
+
+			const auto b = mpp::product(a, expected);
+			const auto x = mpp::solve(a, b);
+
+			expect(type<std::remove_const_t<decltype(x)>> == type<mpp::matrix<double, mpp::dynamic, 1>>);
+			expect(close_to(x, expected));
+		};
+
+		given("A wider band that needs pivoting") = []() {
+			// The leading zero pivot can't be eliminated without swapping rows
+			const auto dense =
+				mpp::matrix<double>{ { 0, 2, 1, 0 }, { 3, 1, 0, 2 }, { 1, 4, 2, 1 }, { 0, 2, 5, 3 } };
+			const auto banded   = mpp::banded_matrix<double, 2, 2>{ dense };
+			const auto expected = mpp::matrix<double>{ { 1, -1 }, { 2, 0 }, { 3, 1 }, { 4, 2 } };
+			const auto b        = mpp::matrix<double>{ dense * expected };
+
+			expect(close_to(mpp::solve(banded, b), expected));
+			expect(close_to(mpp::solve(mpp::banded_matrix<double>{ dense, 2, 2 }, b), expected));
+		};
+
+		given("An integer tridiagonal system") = []() {
+			const auto a = mpp::tridiagonal_matrix<int>{ mpp::matrix<int>{ { 2, 1 }, { 1, 3 } } };
+			const auto x = mpp::solve(a, mpp::matrix<int, mpp::dynamic, 1>{ { 3 }, { 4 } });
+
+			expect(type<std::remove_const_t<decltype(x)>> == type<mpp::matrix<double, mpp::dynamic, 1>>)
+				<< "Integral systems should be solved in floating point";
+			expect(close_to(x, mpp::matrix<double, 2, 1>{ { 1.0 }, { 1.0 } }));
+		};
+	};
+
+	scenario("Symmetric matrices should only store their lower triangle") = []() {
+		given("A dense symmetric matrix") = []() {
+			const auto dense = mpp::matrix<int>{ { 1, 2, 3 }, { 2, 4, 5 }, { 3, 5, 6 } };
+			auto symmetric   = mpp::symmetric_matrix<int>{ dense };
+
+			expect(symmetric.rows() == 3_ul);
+			expect(std::ranges::equal(std::span{ symmetric.data(), mpp::packed_size(3) },
+				std::vector<int>{ 1, 2, 4, 3, 5, 6 }));
+			expect(mpp::matrix<int>{ symmetric } == dense);
+
+			when("I modify an element above the diagonal") = [&]() {
+				symmetric(0, 2) = 7;
+
+				expect(symmetric(2, 0) == 7_i) << "The mirrored element should be the same one";
+				expect(mpp::matrix<int>{ symmetric } == mpp::transpose(mpp::matrix<int>{ symmetric }));
+			};
+		};
+
+		given("Products with dense operands") = []() {
+			const auto dense     = mpp::matrix<double>{ { 4, 1, 2 }, { 1, 3, 0 }, { 2, 0, 5 } };
+			const auto symmetric = mpp::symmetric_matrix<double>{ dense };
+			const auto vector    = mpp::matrix<double, mpp::dynamic, 1>{ { 1 }, { -2 }, { 3 } };
+			const auto right     = mpp::matrix<double>{ { 1, 2 }, { 3, 4 }, { 5, 6 } };
+
+			expect(mpp::product(symmetric, vector) == mpp::matrix<double>{ dense * vector });
+			expect(mpp::product(symmetric, right) == mpp::matrix<double>{ dense * right });
+		};
+
+		given("Samples stored one per row") = []() {
+			const auto samples = mpp::matrix<double>{ { 1, 2, 0 }, { -1, 0, 3 }, { 2, 1, 1 }, { 0, -2, 4 } };
+			const auto gram    = mpp::gram(samples);
+
+			expect(type<std::remove_const_t<decltype(gram)>> == type<mpp::symmetric_matrix<double>>);
+			expect(mpp::matrix<double>{ gram } == mpp::matrix<double>{ mpp::transposed(samples) * samples });
+		};
+	};
+
+	scenario("Diagonal, identity and constant matrices shouldn't store their zeros") = []() {
+		const auto dense = mpp::matrix<double>{ { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } };
+
+		given("A diagonal matrix") = [&]() {
+			const auto diagonal = mpp::diagonal_matrix{ std::vector<double>{ 2, 3, 4 } };
+			const auto expanded = mpp::matrix<double>{ diagonal };
+
+			expect(type<std::remove_const_t<decltype(diagonal)>> == type<mpp::diagonal_matrix<double>>);
+			expect(expanded == mpp::matrix<double>{ { 2, 0, 0 }, { 0, 3, 0 }, { 0, 0, 4 } });
+
+			then("Products should scale the rows or the columns of the other operand") = [&]() {
+				expect(mpp::matrix<double>{ diagonal * dense } == mpp::matrix<double>{ expanded * dense });
+				expect(mpp::matrix<double>{ dense * diagonal } == mpp::matrix<double>{ dense * expanded });
+				expect(mpp::matrix<double>{ diagonal * diagonal } == mpp::matrix<double>{ expanded * expanded });
+				expect(mpp::product(diagonal, dense) == mpp::matrix<double>{ expanded * dense });
+			};
+
+			then("Sums should work like any other expression") = [&]() {
+				expect(mpp::matrix<double>{ diagonal + dense } == mpp::matrix<double>{ expanded + dense });
+			};
+		};
+
+		given("An identity matrix") = [&]() {
+			const auto identity = mpp::identity_matrix<double>{ 3 };
+
+			expect(mpp::matrix<double>{ identity } == mpp::matrix<double>{ 3, 3, mpp::identity });
+			expect(mpp::matrix<double>{ identity * dense } == dense);
+			expect(mpp::matrix<double>{ dense * identity } == dense);
+			expect(mpp::matrix<double>{ dense - identity } ==
+				   mpp::matrix<double>{ { 0, 2, 3 }, { 4, 4, 6 }, { 7, 8, 8 } });
+		};
+
+		given("A constant matrix") = [&]() {
+			const auto ones = mpp::constant_matrix<double>{ 3, 3, 1.0 };
+
+			expect(mpp::matrix<double>{ ones } == mpp::matrix<double, 3, 3>{ 1.0 });
+			expect(mpp::matrix<double>{ dense + ones } ==
+				   mpp::matrix<double>{ { 2, 3, 4 }, { 5, 6, 7 }, { 8, 9, 10 } });
+			expect(mpp::product(ones, dense) == mpp::matrix<double>{ mpp::matrix<double>{ ones } * dense });
+			expect(mpp::product(dense, ones) == mpp::matrix<double>{ dense * mpp::matrix<double>{ ones } });
+		};
+	};
+
+	scenario("Products with structured matrices should read each element of the other operand once") = []() {
+		const auto dense = mpp::matrix<double>{ { 1, 2, 3, 4 }, { 5, 6, 7, 8 }, { 9, 10, 11, 12 }, { 13, 14, 15, 16 } };
+		auto reads       = std::size_t{};
+		const auto other = counted_reads{ dense, reads };
+
+		given("A diagonal operand") = [&]() {
+			const auto diagonal = mpp::diagonal_matrix{ std::vector<double>{ 2, 3, 4, 5 } };
+			const auto expanded = mpp::matrix<double>{ diagonal };
+
+			reads             = 0;
+			const auto scaled = mpp::matrix<double>{ diagonal * other };
+
+			expect(reads == 16_ul);
+			expect(scaled == mpp::matrix<double>{ expanded * dense });
+
+			reads                    = 0;
+			const auto column_scaled = mpp::matrix<double>{ other * diagonal };
+
+			expect(reads == 16_ul);
+			expect(column_scaled == mpp::matrix<double>{ dense * expanded });
+		};
+
+		given("A constant operand") = [&]() {
+			const auto twos     = mpp::constant_matrix<double>{ 4, 4, 2.0 };
+			const auto expanded = mpp::matrix<double>{ twos };
+
+			reads             = 0;
+			const auto summed = mpp::product(twos, other);
+
+			expect(reads == 16_ul);
+			expect(summed == mpp::matrix<double>{ expanded * dense });
+
+			reads                 = 0;
+			const auto row_summed = mpp::product(other, twos);
+
+			expect(reads == 16_ul);
+			expect(row_summed == mpp::matrix<double>{ dense * expanded });
+		};
+	};
+
+	return 0;
+}
@@ -19,6 +19,7 @@
 
 #include <boost/ut.hpp>
 
+#include <mpp/arithmetic.hpp>
 #include <mpp/matrix.hpp>
 #include <mpp/utility.hpp>
 
@@ -106,6 +107,40 @@ namespace
 			expect(out == expected_cmp);
 		} | Mats{};
 	}
+
+	template<typename Mats, typename Order>
+	void test_cmp_elems_expr(std::string_view test_name)
+	{
+		test(test_name.data()) = [&, test_name]<typename T,
+									 typename T2,
+									 std::size_t RowsExtent,
+									 std::size_t RowsExtent2,
+									 std::size_t ColumnsExtent,
+									 std::size_t ColumnsExtent2,
+									 typename Alloc,
+									 typename Alloc2>(
+									 std::tuple<std::type_identity<matrix<T, RowsExtent, ColumnsExtent, Alloc>>,
+										 std::type_identity<matrix<T2, RowsExtent2, ColumnsExtent2, Alloc2>>>) {
+			using mat_t  = matrix<T, RowsExtent, ColumnsExtent, Alloc>;
+			using mat2_t = matrix<T2, RowsExtent2, ColumnsExtent2, Alloc2>;
+
+			const auto [mat, mat2, expected_cmp] =
+				parse_test(test_name, parse_mat<mat_t>, parse_mat<mat2_t>, parse_ordering<Order>);
+
+			// Neither expression object is evaluated into a matrix
+			const auto expr  = mat * T{ 1 };
+			const auto expr2 = mat2 + mat2 * T2{ 0 };
+
+			expect(elements_compare(expr, expr2, floating_point_compare) == expected_cmp);
+			expect(elements_compare(expr, mat2, floating_point_compare) == expected_cmp);
+			expect((expr <=> expr2) == expected_cmp);
+
+			const auto expected_eq = expected_cmp == 0 && mat.rows() == mat2.rows() && mat.columns() == mat2.columns();
+
+			expect((expr == expr2) == expected_eq);
+			expect((mat == expr2) == expected_eq);
+		} | Mats{};
+	}
 } // namespace
 
 int main()
@@ -154,5 +189,16 @@ int main()
 			"utilities/cmp_elems/4x4_4x4.txt");
 	};
 
+	feature("Elements comparison (expression objects)") = []() {
+		test_cmp_elems_expr<join_mats<all_mats<int, 0, 0>, all_mats<int, 0, 0>>, std::strong_ordering>(
+			"utilities/cmp_elems/0x0_0x0.txt");
+		test_cmp_elems_expr<join_mats<all_mats<int, 3, 3>, all_mats<int, 3, 3>>, std::strong_ordering>(
+			"utilities/cmp_elems/3x3_3x3.txt");
+		test_cmp_elems_expr<join_mats<all_mats<float, 4, 4>, all_mats<float, 4, 4>>, std::partial_ordering>(
+			"utilities/cmp_elems/4x4_4x4.txt");
+		test_cmp_elems_expr<join_mats<all_mats<int, 2, 3>, all_mats<int, 3, 2>>, std::strong_ordering>(
+			"utilities/cmp_elems/2x3_3x2.txt");
+	};
+
 	return 0;
 }
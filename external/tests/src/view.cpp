@@ -0,0 +1,350 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#include <boost/ut.hpp>
+
+#include <mpp/algorithm.hpp>
+#include <mpp/arithmetic.hpp>
+#include <mpp/matrix.hpp>
+#include <mpp/utility.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+int main()
+{
+	using namespace boost::ut::literals;
+	using namespace boost::ut::bdd;
+	using namespace boost::ut;
+
+	when("I check the iterators of a view") = []() {
+		expect(constant<std::random_access_iterator<mpp::matrix_view<double>::iterator>>);
+		expect(constant<std::random_access_iterator<mpp::matrix_view<const double>::const_iterator>>);
+		expect(constant<std::ranges::random_access_range<mpp::matrix_view<int, 2, 3>>>);
+	};
+
+	scenario("Views should refer to external memory without copying it") = []() {
+		given("A view over a raw row-major array") = []() {
+			auto elements = std::array{ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+			const auto view = mpp::matrix_view{ elements.data(), 2, 3 };
+
+			expect(type<std::remove_const_t<decltype(view)>> == type<mpp::matrix_view<double>>);
+			expect(view.rows() == 2_ul);
+			expect(view.columns() == 3_ul);
+			expect(view.is_contiguous());
+			expect(view.data() == elements.data());
+			expect(view(1, 2) == 6.0_d);
+
+			then("Writing through the view writes into the array") = [&]() {
+				view(0, 1) = 20.0;
+				std::ranges::fill(mpp::matrix_view<double, 1, 3>{ elements.data() + 3 }, 0.0);
+
+				expect(elements[1] == 20.0_d);
+				expect(elements[5] == 0.0_d);
+			};
+		};
+
+		given("A strided view over the top-left corner of a wider array") = []() {
+			// clang-format off
+			const auto elements = std::array{ 4.0, 3.0, 2.0, -1.0,
+											  1.0, 5.0, 1.0, -1.0,
+											  2.0, 0.0, 6.0, -1.0 };
+			// clang-format on
+			const auto view   = mpp::matrix_view<const double, 3, 3>{ elements.data(), 3, 3, 4 };
+			const auto copied = mpp::matrix<double, 3, 3>{ view };
+
+			expect(!view.is_contiguous());
+			expect(view.stride() == 4_ul);
+			expect(std::ranges::find(view, -1.0) == view.end()) << "Padding shouldn't be part of the view";
+			expect(std::ranges::equal(view, copied));
+
+			then("Algorithms give the same results as with a copy") = [&]() {
+				expect(mpp::determinant(view) == mpp::determinant(copied));
+				expect(mpp::transpose(view) == mpp::transpose(copied));
+				expect(mpp::inverse(view) == mpp::inverse(copied));
+				expect(mpp::lu_decomposition(view) == mpp::lu_decomposition(copied));
+				const auto first = std::size_t{ 1 };
+				const auto last  = std::size_t{ 2 };
+
+				expect(mpp::block(view, first, first, last, last) == mpp::block(copied, first, first, last, last));
+				expect(mpp::singular(view) == mpp::singular(copied));
+				expect(mpp::square(view));
+				expect(mpp::type(view) == mpp::matrix_type::fully_static);
+			};
+
+			then("It can be used in expressions and comparisons") = [&]() {
+				const auto sum = mpp::matrix<double, 3, 3>{ view + copied * 2.0 };
+
+				expect(sum(2, 2) == 18.0_d);
+				expect(view == copied);
+				expect(mpp::transposed(view) == mpp::transpose(copied));
+				expect(mpp::size_compare(view, copied, true, true) ==
+					   std::pair{ std::partial_ordering::equivalent, std::partial_ordering::equivalent });
+			};
+
+			then("It prints like a matrix") = [&]() {
+				auto view_stream   = std::stringstream{};
+				auto matrix_stream = std::stringstream{};
+
+				view_stream << view;
+				matrix_stream << copied;
+
+				expect(view_stream.str() == matrix_stream.str());
+			};
+		};
+
+		given("Views of matrices") = []() {
+			auto mat            = mpp::matrix<double>{ { 2, 0, 0 }, { 1, 4, 0 }, { 3, 2, 1 } };
+			const auto b_column = mpp::matrix<double>{ { 2 }, { 9 }, { 14 } };
+
+			const auto view       = mpp::matrix_view{ mat };
+			const auto const_view = mpp::matrix_view{ b_column };
+
+			expect(type<std::remove_const_t<decltype(view)>> == type<mpp::matrix_view<double>>);
+			expect(type<std::remove_const_t<decltype(const_view)>> == type<mpp::matrix_view<const double>>);
+
+			const auto x = mpp::forward_substitution(view, const_view);
+
+			expect(x == mpp::forward_substitution(mat, b_column));
+			expect(x(2, 0) == 7.0_d);
+		};
+	};
+
+	scenario("Column-major views should read Fortran ordered data without a transpose") = []() {
+		given("A 3x3 matrix stored column by column") = []() {
+			// clang-format off
+			auto elements = std::array{ 4.0, 1.0, 2.0,
+										3.0, 5.0, 0.0,
+										2.0, 1.0, 6.0 };
+			// clang-format on
+			const auto view = mpp::matrix_view<double, 3, 3, mpp::column_major>{ elements.data() };
+			const auto expected = mpp::matrix<double, 3, 3>{ { 4, 3, 2 }, { 1, 5, 1 }, { 2, 0, 6 } };
+
+			expect(view.is_contiguous());
+			expect(view(0, 1) == 3.0_d);
+			expect(std::ranges::equal(view, expected)) << "Iteration is always in row-major order";
+			expect(view == expected);
+
+			then("Algorithms give the same results as with the row-major matrix") = [&]() {
+				expect(mpp::determinant(view) == mpp::determinant(expected));
+				expect(mpp::inverse(view) == mpp::inverse(expected));
+				expect(mpp::transpose(view) == mpp::transpose(expected));
+				expect(mpp::lu_decomposition(view) == mpp::lu_decomposition(expected));
+			};
+
+			when("I assign to a block of it") = [&]() {
+				const auto block = mpp::submatrix(view, 1U, 1U, 2U, 2U);
+
+				expect(type<std::remove_const_t<decltype(block)>> ==
+					   type<mpp::matrix_view<double, mpp::dynamic, mpp::dynamic, mpp::column_major>>);
+				expect(block.stride() == 3_ul);
+
+				mpp::submatrix(view, 1U, 1U, 2U, 2U) = mpp::matrix<double, 2, 2>{ { 10, 11 }, { 12, 13 } };
+
+				then("The elements are written column by column") = [&]() {
+					expect(elements[4] == 10.0_d);
+					expect(elements[5] == 12.0_d);
+					expect(elements[7] == 11.0_d);
+					expect(elements[8] == 13.0_d);
+				};
+			};
+		};
+
+		given("A column-major view with a leading dimension bigger than its rows") = []() {
+			const auto elements = std::array{ 1, 2, -1, 3, 4, -1, 5, 6, -1 };
+			const auto view     = mpp::matrix_view<const int, mpp::dynamic, mpp::dynamic, mpp::column_major>{
+				elements.data(),
+				2,
+				3,
+				3
+			};
+
+			expect(!view.is_contiguous());
+			expect(view == mpp::matrix<int>{ { 1, 3, 5 }, { 2, 4, 6 } });
+			expect(std::ranges::find(view, -1) == view.end());
+		};
+
+		given("A column-major matrix adopting Fortran ordered elements") = []() {
+			auto mat = mpp::column_major_matrix<double>{ 3, 3, std::vector<double>{ 4, 1, 2, 3, 5, 0, 2, 1, 6 } };
+			const auto expected = mpp::matrix<double, 3, 3>{ { 4, 3, 2 }, { 1, 5, 1 }, { 2, 0, 6 } };
+
+			expect(mat == expected);
+			expect(std::ranges::equal(mat, expected)) << "Iteration is always in row-major order";
+			expect(mat.column_data(1)[2] == 0.0_d) << "Columns should be contiguous";
+			expect(type<decltype(mat.view())> ==
+				   type<mpp::matrix_view<double, mpp::dynamic, mpp::dynamic, mpp::column_major>>);
+
+			then("Algorithms and expressions work through its view") = [&]() {
+				expect(mpp::determinant(mat.view()) == mpp::determinant(expected));
+				expect(mpp::inverse(mat.view()) == mpp::inverse(expected));
+
+				mat = mat * mat;
+
+				expect(mat == mpp::matrix<double>{ expected * expected });
+
+				mat = mpp::matrix<double, 2, 3>{ { 1, 2, 3 }, { 4, 5, 6 } };
+
+				expect(mat.rows() == 2_ul);
+				expect(mat.release() == std::vector<double>{ 1, 4, 2, 5, 3, 6 }) << "Stored column by column";
+				expect(mat.size() == 0_ul);
+			};
+		};
+	};
+
+	scenario("Submatrices should refer to the elements of their parent") = []() {
+		given("A 4x4 matrix split into 2x2 tiles") = []() {
+			auto mat = mpp::matrix<int, 4, 4>{ [i = 0]() mutable {
+				return i++;
+			} };
+
+			const auto top_left     = mpp::submatrix(mat, 0U, 0U, 1U, 1U);
+			const auto bottom_right = mpp::submatrix(mat, 2U, 2U, 3U, 3U);
+
+			expect(top_left.stride() == 4_ul);
+			expect(bottom_right(0, 0) == 10_i);
+			expect(bottom_right == mpp::block(mat, 2U, 2U, 3U, 3U));
+
+			when("I assign to a tile") = [&]() {
+				mpp::submatrix(mat, 0U, 2U, 1U, 3U) = top_left + bottom_right;
+
+				then("Only the elements of that tile change") = [&]() {
+					expect(mat(0, 2) == 10_i);
+					expect(mat(1, 3) == 20_i);
+					expect(mat(0, 1) == 1_i);
+					expect(mat(2, 2) == 10_i);
+				};
+			};
+
+			when("I update a tile with compound assignment") = [&]() {
+				auto tile = mpp::submatrix(mat, 2U, 0U, 3U, 1U);
+
+				tile += mpp::matrix<int, 2, 2>{ 100 };
+				tile *= 2;
+				mpp::submatrix(mat, 3U, 0U, 3U, 1U) -= mpp::matrix<int, 1, 2>{ 200 };
+
+				then("The parent is updated in place") = [&]() {
+					expect(mat(2, 0) == 216_i);
+					expect(mat(2, 1) == 218_i);
+					expect(mat(3, 0) == 24_i);
+					expect(mat(3, 1) == 26_i);
+				};
+			};
+		};
+
+		given("A submatrix of a submatrix") = []() {
+			const auto mat   = mpp::matrix<double>{ 5, 5, 1.0 };
+			const auto outer = mpp::submatrix(mat, 1U, 1U, 3U, 3U);
+			const auto inner = mpp::submatrix(outer, 1U, 1U, 2U, 2U);
+
+			expect(type<std::remove_const_t<decltype(inner)>> == type<mpp::matrix_view<const double>>);
+			expect(inner.data() == mat.data() + 12);
+			expect(inner.stride() == 5_ul);
+		};
+
+		given("Views assigned expressions reading other elements of their own memory") = []() {
+			auto mat        = mpp::matrix<int>{ { 1, 2 }, { 3, 4 } };
+			auto view       = mpp::matrix_view{ mat };
+
+			view = mpp::transposed(view);
+
+			expect(mat == mpp::matrix<int>{ { 1, 3 }, { 2, 4 } });
+
+			view += mpp::transposed(view);
+
+			expect(mat == mpp::matrix<int>{ { 2, 5 }, { 5, 8 } });
+
+			view -= mpp::transposed(view);
+
+			expect(mat == mpp::matrix<int>{ { 0, 0 }, { 0, 0 } });
+
+			auto grid = mpp::matrix<int, 3, 3>{ [i = 0]() mutable {
+				return i++;
+			} };
+
+			mpp::submatrix(grid, 1U, 1U, 2U, 2U) = mpp::submatrix(grid, 0U, 0U, 1U, 1U);
+
+			expect(grid == mpp::matrix<int, 3, 3>{ { 0, 1, 2 }, { 3, 0, 1 }, { 6, 3, 4 } });
+		};
+	};
+
+	scenario("Padded matrices should keep their padding out of the elements") = []() {
+		when("I check the automatically chosen leading dimensions") = []() {
+			expect(mpp::padded_leading_dimension<double>(4096) == 4104_ul);
+			expect(mpp::padded_leading_dimension<float>(1024) == 1040_ul);
+			expect(mpp::padded_leading_dimension<double>(4100) == 4100_ul);
+			expect(mpp::padded_leading_dimension<double>(3) == 3_ul);
+		};
+
+		given("A padded matrix with an explicit leading dimension") = []() {
+			auto mat = mpp::padded_matrix<int>{ 3, 3, mpp::row_stride{ 4 }, 1 };
+
+			mat(1, 2) = 5;
+
+			expect(mat.leading_dimension() == 4_ul);
+			expect(mat.data()[6] == 5_i);
+			expect(std::ranges::count(mat, 1) == 8_l);
+			expect(mat.view().stride() == 4_ul);
+
+			then("Algorithms and expressions work through its view") = [&]() {
+				const auto copied = mpp::matrix<int>{ mat };
+
+				expect(mat == copied);
+				expect(mpp::determinant(mat.view()) == mpp::determinant(copied));
+				expect(mpp::transpose(mat.view()) == mpp::transpose(copied));
+
+				mat = mat + copied;
+
+				expect(mat(1, 2) == 10_i);
+				expect(mat.leading_dimension() == 4_ul);
+			};
+		};
+
+		given("A padded matrix evaluated from an expression of a different size") = []() {
+			const auto source = mpp::matrix<double>{ 2, 512, 1.0 };
+			auto mat          = mpp::padded_matrix<double>{};
+
+			mat = source * 2.0;
+
+			expect(mat.rows() == 2_ul);
+			expect(mat.columns() == 512_ul);
+			expect(mat.leading_dimension() == 520_ul);
+			expect(mat(1, 511) == 2.0_d);
+		};
+
+		given("A padded matrix assigned an expression reading other elements of itself") = []() {
+			auto mat = mpp::padded_matrix<int>{ mpp::matrix<int>{ { 1, 2 }, { 3, 4 } } };
+
+			mat = mat * mat;
+
+			expect(mat == mpp::matrix<int>{ { 7, 10 }, { 15, 22 } });
+
+			mat = mpp::transposed(mat);
+
+			expect(mat == mpp::matrix<int>{ { 7, 15 }, { 10, 22 } });
+		};
+	};
+
+	return 0;
+}
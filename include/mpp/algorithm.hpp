@@ -23,6 +23,9 @@
 #include <mpp/algorithm/block.hpp>
 #include <mpp/algorithm/determinant.hpp>
 #include <mpp/algorithm/forward_substitution.hpp>
+#include <mpp/algorithm/gram.hpp>
 #include <mpp/algorithm/inverse.hpp>
 #include <mpp/algorithm/lu_decomposition.hpp>
+#include <mpp/algorithm/product.hpp>
+#include <mpp/algorithm/solve.hpp>
 #include <mpp/algorithm/transpose.hpp>
@@ -20,6 +20,7 @@
 #pragma once
 
 #include <mpp/detail/matrix/matrix_base.hpp>
+#include <mpp/detail/utility/algorithm_helpers.hpp>
 #include <mpp/detail/utility/cpo_base.hpp>
 #include <mpp/detail/utility/utility.hpp>
 #include <mpp/matrix.hpp>
@@ -32,12 +33,12 @@ namespace mpp
 {
 	namespace detail
 	{
-		constexpr void assert_valid_block_dims(std::size_t rows,
-			std::size_t columns,
-			std::size_t top_row_index,
-			std::size_t top_column_index,
-			std::size_t bottom_row_index,
-			std::size_t bottom_column_index)
+		constexpr void assert_valid_block_dims([[maybe_unused]] std::size_t rows,
+			[[maybe_unused]] std::size_t columns,
+			[[maybe_unused]] std::size_t top_row_index,
+			[[maybe_unused]] std::size_t top_column_index,
+			[[maybe_unused]] std::size_t bottom_row_index,
+			[[maybe_unused]] std::size_t bottom_column_index)
 		{
 			// Out of bounds asserts
 
@@ -81,7 +82,7 @@ namespace mpp
 				std::advance(buf_begin, block_columns);
 			}
 
-			return To{ block_rows, block_columns, std::move(buf) };
+			return matrix_from_buffer<To>(block_rows, block_columns, std::move(buf));
 		}
 
 		template<typename To>
@@ -111,7 +112,7 @@ namespace mpp
 				std::ranges::copy_n(row_begin, static_cast<diff_t>(block_columns), inserter);
 			}
 
-			return To{ block_rows, block_columns, std::move(buf) };
+			return matrix_from_buffer<To>(block_rows, block_columns, std::move(buf));
 		}
 
 		template<typename To>
@@ -143,6 +144,31 @@ namespace mpp
 					bottom_column_index);
 			}
 		}
+
+		template<typename Layout, typename Value>
+		[[nodiscard]] inline auto submatrix_impl(Value* data,
+			std::size_t rows,
+			std::size_t columns,
+			std::size_t stride,
+			std::size_t top_row_index,
+			std::size_t top_column_index,
+			std::size_t bottom_row_index,
+			std::size_t bottom_column_index) noexcept
+			-> matrix_view<Value, dynamic, dynamic, Layout> // @TODO: ISSUE #20
+		{
+			assert_valid_block_dims(rows,
+				columns,
+				top_row_index,
+				top_column_index,
+				bottom_row_index,
+				bottom_column_index);
+
+			// The block keeps the layout and the stride of its parent, so it refers to the same elements
+			return { data + Layout::index(stride, top_row_index, top_column_index),
+				bottom_row_index - top_row_index + 1,
+				bottom_column_index - top_column_index + 1,
+				stride };
+		}
 	} // namespace detail
 
 	struct block_t : public detail::cpo_base<block_t>
@@ -162,7 +188,95 @@ namespace mpp
 		{
 			return detail::block_impl<To>(obj, top_row_index, top_column_index, bottom_row_index, bottom_column_index);
 		}
+
+		template<typename Value,
+			std::size_t RowsExtent,
+			std::size_t ColumnsExtent,
+			typename Layout,
+			typename To = matrix<std::remove_const_t<Value>, dynamic, dynamic>>
+		requires(detail::is_matrix<To>::value) [[nodiscard]] friend inline auto tag_invoke(block_t,
+			const matrix_view<Value, RowsExtent, ColumnsExtent, Layout>& obj,
+			std::size_t top_row_index,
+			std::size_t top_column_index,
+			std::size_t bottom_row_index,
+			std::size_t bottom_column_index,
+			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
+		{
+			return detail::block_impl<To>(obj, top_row_index, top_column_index, bottom_row_index, bottom_column_index);
+		}
+	};
+
+	/**
+	 * View of a block of a matrix (or of another view) which refers to the elements of its parent instead of copying
+	 * them like block does. It can be read in expressions and assigned to, so blocks can be updated in place
+	 */
+	struct submatrix_t : public detail::cpo_base<submatrix_t>
+	{
+		template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Allocator>
+		[[nodiscard]] friend inline auto tag_invoke(submatrix_t,
+			matrix<Value, RowsExtent, ColumnsExtent, Allocator>& obj,
+			std::size_t top_row_index,
+			std::size_t top_column_index,
+			std::size_t bottom_row_index,
+			std::size_t bottom_column_index) noexcept -> matrix_view<Value> // @TODO: ISSUE #20
+		{
+			return detail::submatrix_impl<row_major>(obj.data(),
+				obj.rows(),
+				obj.columns(),
+				obj.columns(),
+				top_row_index,
+				top_column_index,
+				bottom_row_index,
+				bottom_column_index);
+		}
+
+		template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Allocator>
+		[[nodiscard]] friend inline auto tag_invoke(submatrix_t,
+			const matrix<Value, RowsExtent, ColumnsExtent, Allocator>& obj,
+			std::size_t top_row_index,
+			std::size_t top_column_index,
+			std::size_t bottom_row_index,
+			std::size_t bottom_column_index) noexcept -> matrix_view<const Value> // @TODO: ISSUE #20
+		{
+			return detail::submatrix_impl<row_major>(obj.data(),
+				obj.rows(),
+				obj.columns(),
+				obj.columns(),
+				top_row_index,
+				top_column_index,
+				bottom_row_index,
+				bottom_column_index);
+		}
+
+		// A view of a temporary matrix would dangle right away
+		template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Allocator>
+		friend void tag_invoke(submatrix_t,
+			matrix<Value, RowsExtent, ColumnsExtent, Allocator>&&,
+			std::size_t,
+			std::size_t,
+			std::size_t,
+			std::size_t) = delete;
+
+		template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Layout>
+		[[nodiscard]] friend inline auto tag_invoke(submatrix_t,
+			const matrix_view<Value, RowsExtent, ColumnsExtent, Layout>& obj,
+			std::size_t top_row_index,
+			std::size_t top_column_index,
+			std::size_t bottom_row_index,
+			std::size_t bottom_column_index) noexcept
+			-> matrix_view<Value, dynamic, dynamic, Layout> // @TODO: ISSUE #20
+		{
+			return detail::submatrix_impl<Layout>(obj.data(),
+				obj.rows(),
+				obj.columns(),
+				obj.stride(),
+				top_row_index,
+				top_column_index,
+				bottom_row_index,
+				bottom_column_index);
+		}
 	};
 
-	inline constexpr auto block = block_t{};
+	inline constexpr auto block     = block_t{};
+	inline constexpr auto submatrix = submatrix_t{};
 } // namespace mpp
@@ -23,6 +23,7 @@
 #include <mpp/detail/utility/algorithm_helpers.hpp>
 #include <mpp/detail/utility/buffer_manipulators.hpp>
 #include <mpp/detail/utility/cpo_base.hpp>
+#include <mpp/memory/workspace.hpp>
 #include <mpp/utility/square.hpp>
 #include <mpp/matrix.hpp>
 
@@ -37,7 +38,7 @@ namespace mpp
 		inline static constexpr auto dummy_variable = ' ';
 
 		template<typename To, typename Mat>
-		[[nodiscard]] inline auto det_impl(const Mat& obj) -> To // @TODO: ISSUE #20
+		[[nodiscard]] inline auto det_impl(const Mat& obj, workspace& arena) -> To // @TODO: ISSUE #20
 		{
 			assert(square(obj));
 
@@ -67,13 +68,13 @@ namespace mpp
 
 			using lu_decomp_buffer_t = typename mat_rebind_to_t<Mat, default_floating_type>::buffer_type;
 
-			auto u_buffer = lu_decomp_buffer_t{};
+			const auto scope = workspace_scope{ arena };
+			auto u_buffer    = make_scratch_buffer<lu_decomp_buffer_t>(arena);
 
 			// If the incoming matrix has an array as its buffer, we can just use the same type of buffer since it'll be
 			// less overhead and we know it's the same size
 
-			allocate_buffer_if_vector(u_buffer, rows, columns, default_floating_type{});
-			std::ranges::copy(obj, u_buffer.begin());
+			copy_into_buffer(u_buffer, obj);
 
 			// The determinant of a LU Decomposition is det(A) = det(L) * det(U) Since det(L) is always 1, we can avoid
 			// creating L entirely
@@ -95,7 +96,45 @@ namespace mpp
 			const matrix<Value, RowsExtent, ColumnsExtent, Allocator>& obj,
 			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
 		{
-			return detail::det_impl<To>(obj);
+			return detail::det_impl<To>(obj, thread_workspace());
+		}
+
+		template<typename Value,
+			std::size_t RowsExtent,
+			std::size_t ColumnsExtent,
+			typename Allocator,
+			typename To = Value>
+		requires(std::is_arithmetic_v<To>) [[nodiscard]] friend inline auto tag_invoke(determinant_t,
+			const matrix<Value, RowsExtent, ColumnsExtent, Allocator>& obj,
+			workspace& arena,
+			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
+		{
+			return detail::det_impl<To>(obj, arena);
+		}
+
+		template<typename Value,
+			std::size_t RowsExtent,
+			std::size_t ColumnsExtent,
+			typename Layout,
+			typename To = std::remove_const_t<Value>>
+		requires(std::is_arithmetic_v<To>) [[nodiscard]] friend inline auto tag_invoke(determinant_t,
+			const matrix_view<Value, RowsExtent, ColumnsExtent, Layout>& obj,
+			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
+		{
+			return detail::det_impl<To>(obj, thread_workspace());
+		}
+
+		template<typename Value,
+			std::size_t RowsExtent,
+			std::size_t ColumnsExtent,
+			typename Layout,
+			typename To = std::remove_const_t<Value>>
+		requires(std::is_arithmetic_v<To>) [[nodiscard]] friend inline auto tag_invoke(determinant_t,
+			const matrix_view<Value, RowsExtent, ColumnsExtent, Layout>& obj,
+			workspace& arena,
+			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
+		{
+			return detail::det_impl<To>(obj, arena);
 		}
 	};
 
@@ -22,6 +22,7 @@
 #include <mpp/detail/types/algo_types.hpp>
 #include <mpp/detail/utility/algorithm_helpers.hpp>
 #include <mpp/detail/utility/cpo_base.hpp>
+#include <mpp/memory/workspace.hpp>
 #include <mpp/utility/comparison.hpp>
 #include <mpp/utility/square.hpp>
 #include <mpp/matrix.hpp>
@@ -34,12 +35,13 @@ namespace mpp
 {
 	namespace detail
 	{
-		template<typename Buf>
-		inline auto forward_subst_on_buffer(const auto& a, const auto& b, std::size_t n) -> Buf // @TODO: ISSUE #20
+		inline void forward_subst_on_buffer(const auto& a,
+			const auto& b,
+			auto& x_buffer,
+			std::size_t n) // @TODO: ISSUE #20
 		{
-			auto x_buffer = Buf{};
-
-			allocate_buffer_if_vector(x_buffer, n, 1, default_floating_type{});
+			// Preconditions:
+			// x_buffer has at least n elements
 
 			/**
 			 * Implementation of forward substitution from
@@ -62,22 +64,26 @@ namespace mpp
 
 				x_buffer[row] = result;
 			}
-
-			return x_buffer;
 		}
 
 		template<typename To>
-		inline auto forward_subst_matrix(const auto& a, const auto& b) -> To // @TODO: ISSUE #20
+		inline auto forward_subst_matrix(const auto& a, const auto& b, workspace& arena) -> To // @TODO: ISSUE #20
 		{
 			assert(square(a));
 			assert(b.columns() == 1);
 
-			const auto rows = a.rows();
+			const auto rows  = a.rows();
+			const auto scope = workspace_scope{ arena };
 
+			// Solved in a scratch buffer and copied into the result, as resizing the result's own buffer would
+			// value-initialize it with allocators like std::allocator
 			using x_mat_t = mat_rebind_to_t<To, default_floating_type>;
-			auto x_buf    = forward_subst_on_buffer<typename x_mat_t::buffer_type>(a.data(), b.data(), rows);
+			auto x_buf    = make_scratch_buffer<typename x_mat_t::buffer_type>(arena);
 
-			return To{ rows, 1, std::move(x_buf) };
+			allocate_uninitialized_buffer_if_vector(x_buf, rows, 1);
+			forward_subst_on_buffer(flat_elements(a), flat_elements(b), x_buf, rows);
+
+			return matrix_from_buffer<To>(rows, 1, std::move(x_buf));
 		}
 	} // namespace detail
 
@@ -99,7 +105,66 @@ namespace mpp
 			const matrix<BValue, BRowsExtent, BColumnsExtent, BAllocator>& b,
 			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
 		{
-			return detail::forward_subst_matrix<To>(a, b);
+			return detail::forward_subst_matrix<To>(a, b, thread_workspace());
+		}
+
+		template<typename AValue,
+			typename BValue,
+			std::size_t ARowsExtent,
+			std::size_t AColumnsExtent,
+			std::size_t BRowsExtent,
+			std::size_t BColumnsExtent,
+			typename AAllocator,
+			typename BAllocator,
+			typename To = matrix<std::common_type_t<AValue, BValue>,
+				detail::prefer_static_extent(ARowsExtent, AColumnsExtent),
+				BColumnsExtent>>
+		requires(detail::is_matrix<To>::value) friend inline auto tag_invoke(forward_substitution_t,
+			const matrix<AValue, ARowsExtent, AColumnsExtent, AAllocator>& a,
+			const matrix<BValue, BRowsExtent, BColumnsExtent, BAllocator>& b,
+			workspace& arena,
+			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
+		{
+			return detail::forward_subst_matrix<To>(a, b, arena);
+		}
+
+		template<typename AValue,
+			typename BValue,
+			std::size_t ARowsExtent,
+			std::size_t AColumnsExtent,
+			std::size_t BRowsExtent,
+			std::size_t BColumnsExtent,
+			typename ALayout,
+			typename BLayout,
+			typename To = matrix<std::common_type_t<AValue, BValue>,
+				detail::prefer_static_extent(ARowsExtent, AColumnsExtent),
+				BColumnsExtent>>
+		requires(detail::is_matrix<To>::value) friend inline auto tag_invoke(forward_substitution_t,
+			const matrix_view<AValue, ARowsExtent, AColumnsExtent, ALayout>& a,
+			const matrix_view<BValue, BRowsExtent, BColumnsExtent, BLayout>& b,
+			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
+		{
+			return detail::forward_subst_matrix<To>(a, b, thread_workspace());
+		}
+
+		template<typename AValue,
+			typename BValue,
+			std::size_t ARowsExtent,
+			std::size_t AColumnsExtent,
+			std::size_t BRowsExtent,
+			std::size_t BColumnsExtent,
+			typename ALayout,
+			typename BLayout,
+			typename To = matrix<std::common_type_t<AValue, BValue>,
+				detail::prefer_static_extent(ARowsExtent, AColumnsExtent),
+				BColumnsExtent>>
+		requires(detail::is_matrix<To>::value) friend inline auto tag_invoke(forward_substitution_t,
+			const matrix_view<AValue, ARowsExtent, AColumnsExtent, ALayout>& a,
+			const matrix_view<BValue, BRowsExtent, BColumnsExtent, BLayout>& b,
+			workspace& arena,
+			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
+		{
+			return detail::forward_subst_matrix<To>(a, b, arena);
 		}
 	};
 
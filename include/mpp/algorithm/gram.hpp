@@ -0,0 +1,66 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/detail/expr/expr_base.hpp>
+#include <mpp/detail/utility/cpo_base.hpp>
+#include <mpp/matrix.hpp>
+
+#include <cstddef>
+
+namespace mpp
+{
+	struct gram_t : public detail::cpo_base<gram_t>
+	{
+		/**
+		 * Gram matrix (transpose of obj times obj, e.g. the scatter matrix of centered samples stored one per row).
+		 * The result is symmetric, so only its lower triangle is computed, each row of obj adding to it in place
+		 */
+		template<typename Expr, typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent>
+		[[nodiscard]] friend inline auto tag_invoke(gram_t,
+			const detail::expr_base<Expr, Value, RowsExtent, ColumnsExtent>& obj)
+			-> symmetric_matrix<Value> // @TODO: ISSUE #20
+		{
+			const auto columns = obj.columns();
+
+			auto result       = symmetric_matrix<Value>{ columns };
+			const auto packed = result.data();
+
+			for (auto row = std::size_t{}; row < obj.rows(); ++row)
+			{
+				for (auto column = std::size_t{}; column < columns; ++column)
+				{
+					const auto value      = obj(row, column);
+					const auto packed_row = packed + packed_size(column);
+
+					for (auto index = std::size_t{}; index <= column; ++index)
+					{
+						packed_row[index] = static_cast<Value>(packed_row[index] + value * obj(row, index));
+					}
+				}
+			}
+
+			return result;
+		}
+	};
+
+	inline constexpr auto gram = gram_t{};
+} // namespace mpp
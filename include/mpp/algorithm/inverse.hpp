@@ -25,6 +25,7 @@
 #include <mpp/detail/utility/algorithm_helpers.hpp>
 #include <mpp/detail/utility/buffer_manipulators.hpp>
 #include <mpp/detail/utility/cpo_base.hpp>
+#include <mpp/memory/workspace.hpp>
 #include <mpp/utility/comparison.hpp>
 #include <mpp/utility/square.hpp>
 #include <mpp/matrix.hpp>
@@ -39,7 +40,7 @@ namespace mpp
 	namespace detail
 	{
 		template<typename To, typename Mat>
-		[[nodiscard]] inline auto inv_impl(const Mat& obj) -> To // @TODO: ISSUE #20
+		[[nodiscard]] inline auto inv_impl(const Mat& obj, workspace& arena) -> To // @TODO: ISSUE #20
 		{
 			assert(square(obj));
 
@@ -54,12 +55,12 @@ namespace mpp
 				return To{};
 			}
 
-			auto inv_buffer = lu_buf_t{};
+			// The inverse is computed column by column in a scratch buffer and copied into the result at the end, as
+			// resizing the result's own buffer would value-initialize it with allocators like std::allocator
+			const auto scope = workspace_scope{ arena };
+			auto inv_buffer  = make_scratch_buffer<lu_buf_t>(arena);
 
-			// If the incoming matrix has an array as its buffer, we can just use the same type of buffer since it'll be
-			// less overhead and we know it's the same size
-
-			allocate_buffer_if_vector(inv_buffer, rows, columns, default_floating_type{});
+			allocate_uninitialized_buffer_if_vector(inv_buffer, rows, columns);
 
 			if (rows == 1)
 			{
@@ -94,25 +95,29 @@ namespace mpp
 
 			if (rows >= 3)
 			{
-				auto l_buffer = lu_buf_t{};
-				auto u_buffer = lu_buf_t{};
+				auto l_buffer = make_scratch_buffer<lu_buf_t>(arena);
+				auto u_buffer = make_scratch_buffer<lu_buf_t>(arena);
 
-				// @TODO: Should do a direct buffer copy initialization instead
-				allocate_buffer_if_vector(u_buffer, rows, columns, default_floating_type{});
-				std::ranges::copy(obj, u_buffer.begin());
+				copy_into_buffer(u_buffer, obj);
 
 				make_identity_buffer(l_buffer, rows, columns, default_floating_type{}, default_floating_type{ 1 });
 
-				const auto det = lu_generic<default_floating_type, true, true>(rows, columns, l_buffer, u_buffer);
+				[[maybe_unused]] const auto det =
+					lu_generic<default_floating_type, true, true>(rows, columns, l_buffer, u_buffer);
 
 				assert(!fp_is_zero_or_nan(det));
 
 				// Solve for x_buffer values with Ax=b where A=l_buffer and b=Column of identity matrix
 
 				using x_buf_t = typename matrix<default_floating_type, Mat::rows_extent(), 1>::buffer_type;
-				auto identity_column_buffer = x_buf_t{};
+
+				auto identity_column_buffer = make_scratch_buffer<x_buf_t>(arena);
+				auto l_x_buffer             = make_scratch_buffer<x_buf_t>(arena);
+				auto part_inverse_buffer    = make_scratch_buffer<x_buf_t>(arena);
 
 				allocate_buffer_if_vector(identity_column_buffer, rows, 1, default_floating_type{});
+				allocate_uninitialized_buffer_if_vector(l_x_buffer, rows, 1);
+				allocate_uninitialized_buffer_if_vector(part_inverse_buffer, rows, 1);
 
 				for (auto row = std::size_t{}; row < rows; ++row)
 				{
@@ -129,21 +134,22 @@ namespace mpp
 					identity_column_buffer[last_column_index] = default_floating_type{};
 					identity_column_buffer[row]               = default_floating_type{ 1 };
 
-					auto l_x_buffer = forward_subst_on_buffer<x_buf_t>(l_buffer, identity_column_buffer, rows);
+					forward_subst_on_buffer(l_buffer, identity_column_buffer, l_x_buffer, rows);
 
 					// Use l_x_buffer to do back substitution to solve Ax=B with A=u_buffer and b=l_x_buffer. The
-					// part_inverse_buffer now corresponds to a column of the inverse matrix
+					// part_inverse_buffer now corresponds to a column of the inverse matrix. Both buffers are reused
+					// for every column
 
-					auto part_inverse_buffer = back_subst_on_buffer<x_buf_t>(u_buffer, std::move(l_x_buffer), rows);
+					back_subst_on_buffer(u_buffer, l_x_buffer, part_inverse_buffer, rows);
 
-					for (auto column = std::size_t{}; auto&& value : part_inverse_buffer)
+					for (auto column = std::size_t{}; column < rows; ++column)
 					{
-						inv_buffer[index_2d_to_1d(columns, column++, row)] = std::move(value);
+						inv_buffer[index_2d_to_1d(columns, column, row)] = part_inverse_buffer[column];
 					}
 				}
 			}
 
-			return To{ rows, columns, std::move(inv_buffer) };
+			return matrix_from_buffer<To>(rows, columns, std::move(inv_buffer));
 		}
 	} // namespace detail
 
@@ -158,7 +164,45 @@ namespace mpp
 			const matrix<Value, RowsExtent, ColumnsExtent, Allocator>& obj,
 			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
 		{
-			return detail::inv_impl<To>(obj);
+			return detail::inv_impl<To>(obj, thread_workspace());
+		}
+
+		template<typename Value,
+			std::size_t RowsExtent,
+			std::size_t ColumnsExtent,
+			typename Allocator,
+			typename To = matrix<Value, RowsExtent, ColumnsExtent, Allocator>>
+		requires(detail::is_matrix<To>::value) [[nodiscard]] friend inline auto tag_invoke(inverse_t,
+			const matrix<Value, RowsExtent, ColumnsExtent, Allocator>& obj,
+			workspace& arena,
+			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
+		{
+			return detail::inv_impl<To>(obj, arena);
+		}
+
+		template<typename Value,
+			std::size_t RowsExtent,
+			std::size_t ColumnsExtent,
+			typename Layout,
+			typename To = matrix<std::remove_const_t<Value>, RowsExtent, ColumnsExtent>>
+		requires(detail::is_matrix<To>::value) [[nodiscard]] friend inline auto tag_invoke(inverse_t,
+			const matrix_view<Value, RowsExtent, ColumnsExtent, Layout>& obj,
+			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
+		{
+			return detail::inv_impl<To>(obj, thread_workspace());
+		}
+
+		template<typename Value,
+			std::size_t RowsExtent,
+			std::size_t ColumnsExtent,
+			typename Layout,
+			typename To = matrix<std::remove_const_t<Value>, RowsExtent, ColumnsExtent>>
+		requires(detail::is_matrix<To>::value) [[nodiscard]] friend inline auto tag_invoke(inverse_t,
+			const matrix_view<Value, RowsExtent, ColumnsExtent, Layout>& obj,
+			workspace& arena,
+			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
+		{
+			return detail::inv_impl<To>(obj, arena);
 		}
 	};
 
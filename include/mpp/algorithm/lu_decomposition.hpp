@@ -21,6 +21,7 @@
 
 #include <mpp/detail/utility/algorithm_helpers.hpp>
 #include <mpp/detail/utility/cpo_base.hpp>
+#include <mpp/memory/workspace.hpp>
 #include <mpp/utility/square.hpp>
 #include <mpp/matrix.hpp>
 
@@ -34,7 +35,7 @@ namespace mpp
 	namespace detail
 	{
 		template<typename To, typename To2, typename Mat>
-		auto lu_impl(const Mat& obj) -> std::pair<To, To2> // @TODO: ISSUE #20
+		auto lu_impl(const Mat& obj, workspace& arena) -> std::pair<To, To2> // @TODO: ISSUE #20
 		{
 			assert(square(obj));
 
@@ -43,18 +44,18 @@ namespace mpp
 			const auto rows    = obj.rows();
 			const auto columns = obj.columns();
 
-			auto l_buffer = lu_buffer_t{};
-			auto u_buffer = lu_buffer_t{};
+			const auto scope = workspace_scope{ arena };
+			auto l_buffer    = make_result_buffer<To, lu_buffer_t>(arena);
+			auto u_buffer    = make_result_buffer<To2, lu_buffer_t>(arena);
 
-			// @TODO: Should do a direct buffer copy initialization instead
-			allocate_buffer_if_vector(u_buffer, rows, columns, default_floating_type{});
-			std::ranges::copy(obj, u_buffer.begin());
+			copy_into_buffer(u_buffer, obj);
 
 			make_identity_buffer(l_buffer, rows, columns, default_floating_type{}, default_floating_type{ 1 });
 
 			lu_generic<default_floating_type, true, false>(rows, columns, l_buffer, u_buffer);
 
-			return { To{ rows, columns, std::move(l_buffer) }, To2{ rows, columns, std::move(u_buffer) } };
+			return { matrix_from_buffer<To>(rows, columns, std::move(l_buffer)),
+				matrix_from_buffer<To2>(rows, columns, std::move(u_buffer)) };
 		}
 	} // namespace detail
 
@@ -71,7 +72,51 @@ namespace mpp
 			std::type_identity<To>  = {},
 			std::type_identity<To2> = {}) -> std::pair<To, To2> // @TODO: ISSUE #20
 		{
-			return detail::lu_impl<To, To2>(obj);
+			return detail::lu_impl<To, To2>(obj, thread_workspace());
+		}
+
+		template<typename Value,
+			std::size_t RowsExtent,
+			std::size_t ColumnsExtent,
+			typename Allocator,
+			typename To  = matrix<Value, RowsExtent, ColumnsExtent, Allocator>,
+			typename To2 = matrix<Value, RowsExtent, ColumnsExtent, Allocator>>
+		requires(detail::is_matrix<To>::value) friend inline auto tag_invoke(lu_decomposition_t,
+			const matrix<Value, RowsExtent, ColumnsExtent, Allocator>& obj,
+			workspace& arena,
+			std::type_identity<To>  = {},
+			std::type_identity<To2> = {}) -> std::pair<To, To2> // @TODO: ISSUE #20
+		{
+			return detail::lu_impl<To, To2>(obj, arena);
+		}
+
+		template<typename Value,
+			std::size_t RowsExtent,
+			std::size_t ColumnsExtent,
+			typename Layout,
+			typename To  = matrix<std::remove_const_t<Value>, RowsExtent, ColumnsExtent>,
+			typename To2 = matrix<std::remove_const_t<Value>, RowsExtent, ColumnsExtent>>
+		requires(detail::is_matrix<To>::value) friend inline auto tag_invoke(lu_decomposition_t,
+			const matrix_view<Value, RowsExtent, ColumnsExtent, Layout>& obj,
+			std::type_identity<To>  = {},
+			std::type_identity<To2> = {}) -> std::pair<To, To2> // @TODO: ISSUE #20
+		{
+			return detail::lu_impl<To, To2>(obj, thread_workspace());
+		}
+
+		template<typename Value,
+			std::size_t RowsExtent,
+			std::size_t ColumnsExtent,
+			typename Layout,
+			typename To  = matrix<std::remove_const_t<Value>, RowsExtent, ColumnsExtent>,
+			typename To2 = matrix<std::remove_const_t<Value>, RowsExtent, ColumnsExtent>>
+		requires(detail::is_matrix<To>::value) friend inline auto tag_invoke(lu_decomposition_t,
+			const matrix_view<Value, RowsExtent, ColumnsExtent, Layout>& obj,
+			workspace& arena,
+			std::type_identity<To>  = {},
+			std::type_identity<To2> = {}) -> std::pair<To, To2> // @TODO: ISSUE #20
+		{
+			return detail::lu_impl<To, To2>(obj, arena);
 		}
 	};
 
@@ -0,0 +1,497 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/algorithm/transpose.hpp>
+#include <mpp/arithmetic/multiply.hpp>
+#include <mpp/detail/expr/expr_base.hpp>
+#include <mpp/detail/utility/algorithm_helpers.hpp>
+#include <mpp/detail/utility/cpo_base.hpp>
+#include <mpp/matrix.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace mpp
+{
+	/**
+	 * Number of threads an algorithm may split its work across (including the calling thread)
+	 */
+	struct thread_count
+	{
+		std::size_t value;
+	};
+
+	namespace detail
+	{
+		template<typename To, typename Value, typename Allocator>
+		void csr_product_rows(const csr_matrix<Value, Allocator>& left,
+			const auto& right,
+			To& result,
+			std::size_t first_row,
+			std::size_t last_row) // @TODO: ISSUE #20
+		{
+			using result_value_t = typename To::value_type;
+
+			const auto row_offsets    = left.row_offsets();
+			const auto column_indices = left.column_indices();
+			const auto values         = left.values();
+			const auto columns        = right.columns();
+			const auto result_data    = result.data();
+
+			for (auto row = first_row; row < last_row; ++row)
+			{
+				const auto row_data = result_data + row * columns;
+
+				if (columns == 1)
+				{
+					// Sparse matrix times vector, summed in a register instead of in the result
+					auto sum = result_value_t{};
+
+					for (auto index = row_offsets[row]; index < row_offsets[row + 1]; ++index)
+					{
+						sum = static_cast<result_value_t>(sum + values[index] * right(column_indices[index], 0));
+					}
+
+					*row_data = sum;
+					continue;
+				}
+
+				std::fill_n(row_data, columns, result_value_t{});
+
+				// Every non-zero element scales a row of the right operand, which is walked contiguously
+				for (auto index = row_offsets[row]; index < row_offsets[row + 1]; ++index)
+				{
+					const auto value     = values[index];
+					const auto right_row = column_indices[index];
+
+					for (auto column = std::size_t{}; column < columns; ++column)
+					{
+						row_data[column] =
+							static_cast<result_value_t>(row_data[column] + value * right(right_row, column));
+					}
+				}
+			}
+		}
+
+		template<typename To, typename Value, typename Allocator>
+		[[nodiscard]] auto csr_product_impl(const csr_matrix<Value, Allocator>& left,
+			const auto& right,
+			std::size_t threads) -> To // @TODO: ISSUE #20
+		{
+			assert(left.columns() == right.rows());
+
+			const auto rows = left.rows();
+			auto result     = make_uninitialized_matrix<To>(rows, right.columns());
+
+			threads = std::clamp(threads, std::size_t{ 1 }, std::max(rows, std::size_t{ 1 }));
+
+			if (threads == 1)
+			{
+				csr_product_rows(left, right, result, 0, rows);
+				return result;
+			}
+
+			// Rows are split so that every thread gets about the same number of non-zero elements
+			const auto row_offsets = left.row_offsets();
+			const auto non_zeros   = left.non_zeros();
+
+			auto boundaries = std::vector<std::size_t>(threads + 1, rows);
+			boundaries[0]   = 0;
+
+			for (auto thread = std::size_t{ 1 }; thread < threads; ++thread)
+			{
+				const auto target = non_zeros * thread / threads;
+				const auto found  = std::lower_bound(row_offsets.begin(), row_offsets.end() - 1, target);
+
+				boundaries[thread] = std::max(boundaries[thread - 1],
+					static_cast<std::size_t>(found - row_offsets.begin()));
+			}
+
+			{
+				auto workers = std::vector<std::jthread>{};
+				workers.reserve(threads - 1);
+
+				for (auto thread = std::size_t{ 1 }; thread < threads; ++thread)
+				{
+					workers.emplace_back([&, thread]() {
+						csr_product_rows(left, right, result, boundaries[thread], boundaries[thread + 1]);
+					});
+				}
+
+				csr_product_rows(left, right, result, boundaries[0], boundaries[1]);
+			}
+
+			return result;
+		}
+
+		template<typename To>
+		[[nodiscard]] auto banded_product_impl(const auto& left, const auto& right) -> To // @TODO: ISSUE #20
+		{
+			using result_value_t = typename To::value_type;
+
+			assert(left.columns() == right.rows());
+
+			const auto rows        = left.rows();
+			const auto columns     = right.columns();
+			auto result            = make_uninitialized_matrix<To>(rows, columns);
+			const auto result_data = result.data();
+
+			for (auto row = std::size_t{}; row < rows; ++row)
+			{
+				const auto row_data = result_data + row * columns;
+
+				std::fill_n(row_data, columns, result_value_t{});
+
+				for (auto index = left.first_column(row); index < left.last_column(row); ++index)
+				{
+					const auto value = left.band(row, index);
+
+					for (auto column = std::size_t{}; column < columns; ++column)
+					{
+						row_data[column] = static_cast<result_value_t>(row_data[column] + value * right(index, column));
+					}
+				}
+			}
+
+			return result;
+		}
+
+		/**
+		 * Every row of a constant matrix is the same, so every row of its product is the column sums of the right
+		 * operand scaled by the constant. They're computed once, which takes O(n^2) instead of O(n^3)
+		 */
+		template<typename To>
+		[[nodiscard]] auto constant_left_product_impl(const auto& left, const auto& right) -> To // @TODO: ISSUE #20
+		{
+			using result_value_t = typename To::value_type;
+
+			assert(left.columns() == right.rows());
+
+			const auto rows    = left.rows();
+			const auto columns = right.columns();
+			auto sums          = std::vector<result_value_t>(columns);
+
+			for (auto index = std::size_t{}; index < right.rows(); ++index)
+			{
+				for (auto column = std::size_t{}; column < columns; ++column)
+				{
+					sums[column] = static_cast<result_value_t>(sums[column] + right(index, column));
+				}
+			}
+
+			for (auto& sum : sums)
+			{
+				sum = static_cast<result_value_t>(left.value() * sum);
+			}
+
+			auto result            = make_uninitialized_matrix<To>(rows, columns);
+			const auto result_data = result.data();
+
+			for (auto row = std::size_t{}; row < rows; ++row)
+			{
+				std::ranges::copy(sums, result_data + row * columns);
+			}
+
+			return result;
+		}
+
+		/**
+		 * Same as above with the constant on the right: every row of the result is the sum of the same row of the left
+		 * operand scaled by the constant
+		 */
+		template<typename To>
+		[[nodiscard]] auto constant_right_product_impl(const auto& left, const auto& right) -> To // @TODO: ISSUE #20
+		{
+			using result_value_t = typename To::value_type;
+
+			assert(left.columns() == right.rows());
+
+			const auto rows        = left.rows();
+			const auto columns     = right.columns();
+			auto result            = make_uninitialized_matrix<To>(rows, columns);
+			const auto result_data = result.data();
+
+			for (auto row = std::size_t{}; row < rows; ++row)
+			{
+				auto sum = result_value_t{};
+
+				for (auto index = std::size_t{}; index < left.columns(); ++index)
+				{
+					sum = static_cast<result_value_t>(sum + left(row, index));
+				}
+
+				std::fill_n(result_data + row * columns, columns, static_cast<result_value_t>(sum * right.value()));
+			}
+
+			return result;
+		}
+
+		/**
+		 * Every stored element of the lower triangle is read once and used for both of its mirrored positions
+		 */
+		template<typename To>
+		[[nodiscard]] auto symmetric_product_impl(const auto& left, const auto& right) -> To // @TODO: ISSUE #20
+		{
+			using result_value_t = typename To::value_type;
+
+			assert(left.columns() == right.rows());
+
+			const auto rows        = left.rows();
+			const auto columns     = right.columns();
+			const auto packed      = left.data();
+			auto result            = make_uninitialized_matrix<To>(rows, columns);
+			const auto result_data = result.data();
+
+			std::fill_n(result_data, rows * columns, result_value_t{});
+
+			for (auto row = std::size_t{}; row < rows; ++row)
+			{
+				const auto packed_row = packed + packed_size(row);
+				const auto row_data   = result_data + row * columns;
+
+				for (auto index = std::size_t{}; index < row; ++index)
+				{
+					const auto value      = packed_row[index];
+					const auto mirror_row = result_data + index * columns;
+
+					for (auto column = std::size_t{}; column < columns; ++column)
+					{
+						const auto from_mirror = value * right(index, column);
+						const auto to_mirror   = value * right(row, column);
+
+						row_data[column]   = static_cast<result_value_t>(row_data[column] + from_mirror);
+						mirror_row[column] = static_cast<result_value_t>(mirror_row[column] + to_mirror);
+					}
+				}
+
+				const auto diagonal = packed_row[row];
+
+				for (auto column = std::size_t{}; column < columns; ++column)
+				{
+					row_data[column] = static_cast<result_value_t>(row_data[column] + diagonal * right(row, column));
+				}
+			}
+
+			return result;
+		}
+
+		/**
+		 * Element (row, column) of the result is computed from the words of a row of left and of a row of the
+		 * transposed right operand: it's true when AND-ing them leaves any bit set (boolean), or an odd number of bits
+		 * set (GF(2))
+		 */
+		template<bool Gf2, typename LeftAllocator, typename RightAllocator>
+		[[nodiscard]] auto bit_product_impl(const bit_matrix<LeftAllocator>& left,
+			const bit_matrix<RightAllocator>& right) -> bit_matrix<LeftAllocator> // @TODO: ISSUE #20
+		{
+			using word_type = typename bit_matrix<LeftAllocator>::word_type;
+
+			assert(left.columns() == right.rows());
+
+			const auto right_transposed = mpp::transpose(right);
+			const auto words_per_row    = left.words_per_row();
+
+			auto result = bit_matrix<LeftAllocator>{ left.rows(), right.columns(), false, left.get_allocator() };
+
+			for (auto row = std::size_t{}; row < left.rows(); ++row)
+			{
+				const auto left_words = left.row_data(row);
+
+				for (auto column = std::size_t{}; column < right.columns(); ++column)
+				{
+					const auto right_words = right_transposed.row_data(column);
+
+					auto value = false;
+
+					if constexpr (Gf2)
+					{
+						auto parity = word_type{};
+
+						for (auto index = std::size_t{}; index < words_per_row; ++index)
+						{
+							parity ^= static_cast<word_type>(std::popcount(left_words[index] & right_words[index]));
+						}
+
+						value = (parity & 1) != 0;
+					}
+					else
+					{
+						for (auto index = std::size_t{}; index < words_per_row && !value; ++index)
+						{
+							value = (left_words[index] & right_words[index]) != 0;
+						}
+					}
+
+					result.set(row, column, value);
+				}
+			}
+
+			return result;
+		}
+	} // namespace detail
+
+	struct product_t : public detail::cpo_base<product_t>
+	{
+		/**
+		 * Matrix product evaluated straight into a matrix. Products with a constant matrix on either side only need
+		 * the column (or row) sums of the other operand, so they take O(n^2)
+		 */
+		template<typename Left,
+			typename LeftValue,
+			std::size_t LeftRowsExtent,
+			std::size_t LeftColumnsExtent,
+			typename Right,
+			typename RightValue,
+			std::size_t RightRowsExtent,
+			std::size_t RightColumnsExtent,
+			typename To =
+				matrix<detail::expr_common_value_t<LeftValue, RightValue>, LeftRowsExtent, RightColumnsExtent>>
+		requires(detail::is_matrix<To>::value) [[nodiscard]] friend inline auto tag_invoke(product_t,
+			const detail::expr_base<Left, LeftValue, LeftRowsExtent, LeftColumnsExtent>& left,
+			const detail::expr_base<Right, RightValue, RightRowsExtent, RightColumnsExtent>& right,
+			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
+		{
+			if constexpr (detail::is_constant_matrix<Left>::value)
+			{
+				return detail::constant_left_product_impl<To>(static_cast<const Left&>(left),
+					static_cast<const Right&>(right));
+			}
+			else if constexpr (detail::is_constant_matrix<Right>::value)
+			{
+				return detail::constant_right_product_impl<To>(static_cast<const Left&>(left),
+					static_cast<const Right&>(right));
+			}
+			else
+			{
+				// Products of the derived types, so that the product expression can detect the special ones
+				return To{ static_cast<const Left&>(left) * static_cast<const Right&>(right) };
+			}
+		}
+
+		/**
+		 * Sparse matrix times a dense matrix or vector (a matrix with a single column). Only the non-zero elements of
+		 * the sparse matrix are visited, so the cost is proportional to non_zeros() * right.columns()
+		 */
+		template<typename Value,
+			typename Allocator,
+			typename Right,
+			typename RightValue,
+			std::size_t RightRowsExtent,
+			std::size_t RightColumnsExtent,
+			typename To = matrix<detail::expr_common_value_t<Value, RightValue>, dynamic, RightColumnsExtent>>
+		requires(detail::is_matrix<To>::value) [[nodiscard]] friend inline auto tag_invoke(product_t,
+			const csr_matrix<Value, Allocator>& left,
+			const detail::expr_base<Right, RightValue, RightRowsExtent, RightColumnsExtent>& right,
+			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
+		{
+			return detail::csr_product_impl<To>(left, right, 1);
+		}
+
+		/**
+		 * Same as above, but the rows of the result are split across the given number of threads
+		 */
+		template<typename Value,
+			typename Allocator,
+			typename Right,
+			typename RightValue,
+			std::size_t RightRowsExtent,
+			std::size_t RightColumnsExtent,
+			typename To = matrix<detail::expr_common_value_t<Value, RightValue>, dynamic, RightColumnsExtent>>
+		requires(detail::is_matrix<To>::value) [[nodiscard]] friend inline auto tag_invoke(product_t,
+			const csr_matrix<Value, Allocator>& left,
+			const detail::expr_base<Right, RightValue, RightRowsExtent, RightColumnsExtent>& right,
+			thread_count threads,
+			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
+		{
+			return detail::csr_product_impl<To>(left, right, threads.value);
+		}
+
+		/**
+		 * Banded matrix times a dense matrix or vector, in O(n * (lower + upper + 1)) per column of the right operand
+		 */
+		template<typename Value,
+			std::size_t LowerBandwidth,
+			std::size_t UpperBandwidth,
+			typename Allocator,
+			typename Right,
+			typename RightValue,
+			std::size_t RightRowsExtent,
+			std::size_t RightColumnsExtent,
+			typename To = matrix<detail::expr_common_value_t<Value, RightValue>, dynamic, RightColumnsExtent>>
+		requires(detail::is_matrix<To>::value) [[nodiscard]] friend inline auto tag_invoke(product_t,
+			const banded_matrix<Value, LowerBandwidth, UpperBandwidth, Allocator>& left,
+			const detail::expr_base<Right, RightValue, RightRowsExtent, RightColumnsExtent>& right,
+			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
+		{
+			return detail::banded_product_impl<To>(left, right);
+		}
+
+		/**
+		 * Symmetric matrix times a dense matrix or vector, reading the packed triangle only once
+		 */
+		template<typename Value,
+			typename Allocator,
+			typename Right,
+			typename RightValue,
+			std::size_t RightRowsExtent,
+			std::size_t RightColumnsExtent,
+			typename To = matrix<detail::expr_common_value_t<Value, RightValue>, dynamic, RightColumnsExtent>>
+		requires(detail::is_matrix<To>::value) [[nodiscard]] friend inline auto tag_invoke(product_t,
+			const symmetric_matrix<Value, Allocator>& left,
+			const detail::expr_base<Right, RightValue, RightRowsExtent, RightColumnsExtent>& right,
+			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
+		{
+			return detail::symmetric_product_impl<To>(left, right);
+		}
+
+		/**
+		 * Boolean matrix product (AND for products, OR for sums), e.g. to find the paths of length two in a graph given
+		 * by its adjacency matrix. 64 elements are combined per word operation
+		 */
+		template<typename LeftAllocator, typename RightAllocator>
+		[[nodiscard]] friend inline auto tag_invoke(product_t,
+			const bit_matrix<LeftAllocator>& left,
+			const bit_matrix<RightAllocator>& right) -> bit_matrix<LeftAllocator> // @TODO: ISSUE #20
+		{
+			return detail::bit_product_impl<false>(left, right);
+		}
+
+		/**
+		 * Matrix product over GF(2) (AND for products, XOR for sums), e.g. to encode with a generator matrix
+		 */
+		template<typename LeftAllocator, typename RightAllocator>
+		[[nodiscard]] friend inline auto tag_invoke(product_t,
+			const bit_matrix<LeftAllocator>& left,
+			const bit_matrix<RightAllocator>& right,
+			gf2_tag) -> bit_matrix<LeftAllocator> // @TODO: ISSUE #20
+		{
+			return detail::bit_product_impl<true>(left, right);
+		}
+	};
+
+	inline constexpr auto product = product_t{};
+} // namespace mpp
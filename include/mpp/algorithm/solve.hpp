@@ -0,0 +1,285 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/detail/expr/expr_base.hpp>
+#include <mpp/detail/types/algo_types.hpp>
+#include <mpp/detail/utility/algorithm_helpers.hpp>
+#include <mpp/detail/utility/cpo_base.hpp>
+#include <mpp/memory/default_init_allocator.hpp>
+#include <mpp/memory/workspace.hpp>
+#include <mpp/matrix.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mpp
+{
+	namespace detail
+	{
+		/**
+		 * Floating point type a system is solved in: the common type of both sides, or the default floating point
+		 * type when that one is integral
+		 */
+		template<typename AValue, typename BValue>
+		using solve_value_t = std::conditional_t<std::is_floating_point_v<std::common_type_t<AValue, BValue>>,
+			std::common_type_t<AValue, BValue>,
+			default_floating_type>;
+
+		/**
+		 * Copies the right-hand side into the result, which every solver then overwrites with the solution
+		 */
+		template<typename To>
+		[[nodiscard]] auto solve_init_result(const auto& b) -> To // @TODO: ISSUE #20
+		{
+			using value_t = typename To::value_type;
+
+			auto row    = std::size_t{};
+			auto column = std::size_t{};
+			auto copy   = [&]() -> value_t {
+				const auto value = static_cast<value_t>(b(row, column));
+
+				if (++column == b.columns())
+				{
+					column = 0;
+					++row;
+				}
+
+				return value;
+			};
+
+			return make_generated_matrix<To>(b.rows(), b.columns(), copy);
+		}
+
+		/**
+		 * Thomas algorithm, i.e. Gaussian elimination specialized for tridiagonal matrices in O(n). It doesn't pivot,
+		 * so the matrix is expected to be diagonally dominant or symmetric positive definite (like the ones coming
+		 * from finite difference discretizations)
+		 */
+		template<typename To>
+		[[nodiscard]] auto thomas_solve(const auto& a, const auto& b, workspace& arena) -> To // @TODO: ISSUE #20
+		{
+			using value_t = typename To::value_type;
+
+			const auto n       = a.rows();
+			const auto columns = b.columns();
+			const auto scope   = workspace_scope{ arena };
+
+			auto result = solve_init_result<To>(b);
+			auto x      = result.data();
+
+			if (n == 0)
+			{
+				return result;
+			}
+
+			// Upper diagonal after the elimination, normalized by the pivots. Every element is written before use
+			using upper_allocator_t = default_init_allocator<value_t, workspace_allocator<value_t>>;
+
+			auto upper = std::vector<value_t, upper_allocator_t>(n, upper_allocator_t{ arena });
+
+			auto pivot = static_cast<value_t>(a.band(0, 0));
+
+			assert(!fp_is_zero_or_nan(pivot));
+
+			upper[0] = n > 1 ? static_cast<value_t>(a.band(0, 1)) / pivot : value_t{};
+
+			for (auto column = std::size_t{}; column < columns; ++column)
+			{
+				x[column] /= pivot;
+			}
+
+			for (auto row = std::size_t{ 1 }; row < n; ++row)
+			{
+				const auto lower = static_cast<value_t>(a.band(row, row - 1));
+
+				pivot = static_cast<value_t>(a.band(row, row)) - lower * upper[row - 1];
+
+				assert(!fp_is_zero_or_nan(pivot));
+
+				upper[row] = row + 1 < n ? static_cast<value_t>(a.band(row, row + 1)) / pivot : value_t{};
+
+				for (auto column = std::size_t{}; column < columns; ++column)
+				{
+					auto& element = x[index_2d_to_1d(columns, row, column)];
+					element       = (element - lower * x[index_2d_to_1d(columns, row - 1, column)]) / pivot;
+				}
+			}
+
+			for (auto row = n - 1; row > std::size_t{}; --row)
+			{
+				for (auto column = std::size_t{}; column < columns; ++column)
+				{
+					const auto next = x[index_2d_to_1d(columns, row, column)];
+
+					x[index_2d_to_1d(columns, row - 1, column)] -= upper[row - 1] * next;
+				}
+			}
+
+			return result;
+		}
+
+		/**
+		 * Gaussian elimination with partial pivoting that stays inside the band. Row swaps can move elements up to
+		 * lower_bandwidth() diagonals further right, so the working copy has lower + upper diagonals above the main
+		 * one. Runs in O(n * lower * (lower + upper)) per right-hand side column
+		 */
+		template<typename To>
+		[[nodiscard]] auto banded_lu_solve(const auto& a, const auto& b, workspace& arena) -> To // @TODO: ISSUE #20
+		{
+			using value_t = typename To::value_type;
+
+			const auto n       = a.rows();
+			const auto columns = b.columns();
+			const auto lower   = a.lower_bandwidth();
+			const auto upper   = lower + a.upper_bandwidth();
+			const auto width   = lower + upper + 1;
+			const auto scope   = workspace_scope{ arena };
+
+			auto result = solve_init_result<To>(b);
+			auto x      = result.data();
+
+			auto lu = std::vector<value_t, workspace_allocator<value_t>>(n * width,
+				value_t{},
+				workspace_allocator<value_t>{ arena });
+
+			const auto lu_index = [&](std::size_t row, std::size_t column) {
+				return row * width + column + lower - row;
+			};
+
+			for (auto row = std::size_t{}; row < n; ++row)
+			{
+				for (auto column = a.first_column(row); column < a.last_column(row); ++column)
+				{
+					lu[lu_index(row, column)] = static_cast<value_t>(a.band(row, column));
+				}
+			}
+
+			for (auto pivot_row = std::size_t{}; pivot_row < n; ++pivot_row)
+			{
+				const auto last_row    = std::min(pivot_row + lower + 1, n);
+				const auto last_column = std::min(pivot_row + upper + 1, n);
+
+				auto max_row = pivot_row;
+
+				for (auto row = pivot_row + 1; row < last_row; ++row)
+				{
+					if (std::abs(lu[lu_index(row, pivot_row)]) > std::abs(lu[lu_index(max_row, pivot_row)]))
+					{
+						max_row = row;
+					}
+				}
+
+				if (max_row != pivot_row)
+				{
+					for (auto column = pivot_row; column < last_column; ++column)
+					{
+						std::swap(lu[lu_index(pivot_row, column)], lu[lu_index(max_row, column)]);
+					}
+
+					std::swap_ranges(x + pivot_row * columns, x + (pivot_row + 1) * columns, x + max_row * columns);
+				}
+
+				const auto pivot = lu[lu_index(pivot_row, pivot_row)];
+
+				assert(!fp_is_zero_or_nan(pivot));
+
+				for (auto row = pivot_row + 1; row < last_row; ++row)
+				{
+					const auto factor = lu[lu_index(row, pivot_row)] / pivot;
+
+					for (auto column = pivot_row + 1; column < last_column; ++column)
+					{
+						lu[lu_index(row, column)] -= factor * lu[lu_index(pivot_row, column)];
+					}
+
+					for (auto column = std::size_t{}; column < columns; ++column)
+					{
+						const auto pivot_element = x[index_2d_to_1d(columns, pivot_row, column)];
+
+						x[index_2d_to_1d(columns, row, column)] -= factor * pivot_element;
+					}
+				}
+			}
+
+			// Back substitution over the upper bandwidth of the factorization
+			for (auto row = n; row > std::size_t{}; --row)
+			{
+				const auto row_index   = row - 1;
+				const auto last_column = std::min(row_index + upper + 1, n);
+				const auto pivot       = lu[lu_index(row_index, row_index)];
+
+				for (auto column = std::size_t{}; column < columns; ++column)
+				{
+					auto sum = x[index_2d_to_1d(columns, row_index, column)];
+
+					for (auto index = row_index + 1; index < last_column; ++index)
+					{
+						sum -= lu[lu_index(row_index, index)] * x[index_2d_to_1d(columns, index, column)];
+					}
+
+					x[index_2d_to_1d(columns, row_index, column)] = sum / pivot;
+				}
+			}
+
+			return result;
+		}
+	} // namespace detail
+
+	struct solve_t : public detail::cpo_base<solve_t>
+	{
+		/**
+		 * Solves a * x = b for x, where b has one column per right-hand side. Tridiagonal matrices are solved with the
+		 * Thomas algorithm (no pivoting), other banded matrices with a banded LU with partial pivoting, so both take
+		 * time and memory linear in the size of the matrix instead of the O(n^3) of a dense solve
+		 */
+		template<typename AValue,
+			std::size_t LowerBandwidth,
+			std::size_t UpperBandwidth,
+			typename Allocator,
+			typename Expr,
+			typename BValue,
+			std::size_t BRowsExtent,
+			std::size_t BColumnsExtent,
+			typename To = matrix<detail::solve_value_t<AValue, BValue>, dynamic, BColumnsExtent>>
+		requires(detail::is_matrix<To>::value) [[nodiscard]] friend inline auto tag_invoke(solve_t,
+			const banded_matrix<AValue, LowerBandwidth, UpperBandwidth, Allocator>& a,
+			const detail::expr_base<Expr, BValue, BRowsExtent, BColumnsExtent>& b,
+			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
+		{
+			assert(a.rows() == b.rows());
+
+			if (a.lower_bandwidth() == 1 && a.upper_bandwidth() == 1)
+			{
+				return detail::thomas_solve<To>(a, b, thread_workspace());
+			}
+
+			return detail::banded_lu_solve<To>(a, b, thread_workspace());
+		}
+	};
+
+	inline constexpr auto solve = solve_t{};
+} // namespace mpp
@@ -19,14 +19,20 @@
 
 #pragma once
 
+#include <mpp/detail/expr/expr_base.hpp>
+#include <mpp/detail/expr/expr_unary_op.hpp>
 #include <mpp/detail/matrix/matrix_base.hpp>
+#include <mpp/detail/utility/algorithm_helpers.hpp>
 #include <mpp/detail/utility/buffer_manipulators.hpp>
 #include <mpp/detail/utility/cpo_base.hpp>
 #include <mpp/detail/utility/utility.hpp>
 #include <mpp/matrix.hpp>
 
+#include <bit>
 #include <cstddef>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace mpp
 {
@@ -35,28 +41,33 @@ namespace mpp
 		template<typename To>
 		[[nodiscard]] auto trps_impl(const auto& obj) -> To
 		{
+			using value_t = typename To::value_type;
+
 			const auto rows    = obj.rows();
 			const auto columns = obj.columns();
-			const auto data    = obj.data();
-
-			using trps_buf_t = typename To::buffer_type;
 
-			auto transposed_buffer = trps_buf_t{};
-			allocate_buffer_if_vector(transposed_buffer, columns, rows, typename To::value_type{});
+			// The result is generated row by row (i.e. obj column by column), so no element is initialized before
+			// being written
+			auto row       = std::size_t{};
+			auto column    = std::size_t{};
+			auto transpose = [&]() -> value_t {
+				const auto value = static_cast<value_t>(obj(row, column));
 
-			for (auto column = std::size_t{}; column < columns; ++column)
-			{
-				for (auto row = std::size_t{}; row < rows; ++row)
+				if (++row == rows)
 				{
-					auto normal_index     = detail::index_2d_to_1d(columns, row, column);
-					auto transposed_index = detail::index_2d_to_1d(rows, column, row);
-
-					transposed_buffer[transposed_index] = data[normal_index];
+					row = 0;
+					++column;
 				}
-			}
 
-			return To{ columns, rows, std::move(transposed_buffer) };
+				return value;
+			};
+
+			return make_generated_matrix<To>(columns, rows, transpose);
 		}
+
+		inline constexpr auto trps_op = [](const auto& obj, std::size_t row_index, std::size_t col_index) noexcept {
+			return obj(col_index, row_index);
+		};
 	} // namespace detail
 
 	struct transpose_t : public detail::cpo_base<transpose_t>
@@ -72,7 +83,90 @@ namespace mpp
 		{
 			return detail::trps_impl<To>(obj);
 		}
+
+		template<typename Value,
+			std::size_t RowsExtent,
+			std::size_t ColumnsExtent,
+			typename Layout,
+			typename To = matrix<std::remove_const_t<Value>, ColumnsExtent, RowsExtent>>
+		requires(detail::is_matrix<To>::value) [[nodiscard]] friend inline auto tag_invoke(transpose_t,
+			const matrix_view<Value, RowsExtent, ColumnsExtent, Layout>& obj,
+			std::type_identity<To> = {}) -> To // @TODO: ISSUE #20
+		{
+			return detail::trps_impl<To>(obj);
+		}
+
+		template<typename Value, typename Allocator>
+		[[nodiscard]] friend inline auto tag_invoke(transpose_t, const csr_matrix<Value, Allocator>& obj)
+			-> csr_matrix<Value, Allocator> // @TODO: ISSUE #20
+		{
+			const auto row_offsets    = obj.row_offsets();
+			const auto column_indices = obj.column_indices();
+			const auto values         = obj.values();
+
+			// Rows are walked in order, so the elements already come out sorted within the rows of the result
+			auto triplets = std::vector<triplet<Value>>{};
+			triplets.reserve(obj.non_zeros());
+
+			for (auto row = std::size_t{}; row < obj.rows(); ++row)
+			{
+				for (auto index = row_offsets[row]; index < row_offsets[row + 1]; ++index)
+				{
+					triplets.push_back({ column_indices[index], row, values[index] });
+				}
+			}
+
+			return { obj.columns(), obj.rows(), triplets, obj.get_allocator() };
+		}
+
+		template<typename Allocator>
+		[[nodiscard]] friend inline auto tag_invoke(transpose_t, const bit_matrix<Allocator>& obj)
+			-> bit_matrix<Allocator> // @TODO: ISSUE #20
+		{
+			constexpr auto bits_per_word = bit_matrix<Allocator>::bits_per_word;
+
+			auto result = bit_matrix<Allocator>{ obj.columns(), obj.rows(), false, obj.get_allocator() };
+
+			// Only the set bits are visited, which are found a word at a time
+			for (auto row = std::size_t{}; row < obj.rows(); ++row)
+			{
+				const auto words = obj.row_data(row);
+
+				for (auto word_index = std::size_t{}; word_index < obj.words_per_row(); ++word_index)
+				{
+					for (auto word = words[word_index]; word != 0; word &= word - 1)
+					{
+						const auto bit = static_cast<std::size_t>(std::countr_zero(word));
+
+						result.set(word_index * bits_per_word + bit, row);
+					}
+				}
+			}
+
+			return result;
+		}
+	};
+
+	struct transposed_t : public detail::cpo_base<transposed_t>
+	{
+		/**
+		 * Transposed view of a matrix or an expression object. Nothing is copied, the indices are swapped when an
+		 * element is accessed, so it can be used as an operand of other expressions (including matrix products)
+		 */
+		template<detail::expression Obj>
+		[[nodiscard]] friend inline auto tag_invoke(transposed_t, Obj&& obj) noexcept
+			-> detail::expr_unary_op<detail::expr_columns_extent_v<Obj>,
+				detail::expr_rows_extent_v<Obj>,
+				detail::expr_operand_t<Obj>,
+				std::remove_const_t<decltype(detail::trps_op)>> // @TODO: ISSUE #20
+		{
+			const auto rows    = obj.rows();
+			const auto columns = obj.columns();
+
+			return { std::forward<Obj>(obj), columns, rows, detail::trps_op };
+		}
 	};
 
-	inline constexpr auto transpose = transpose_t{};
+	inline constexpr auto transpose  = transpose_t{};
+	inline constexpr auto transposed = transposed_t{};
 } // namespace mpp
@@ -19,48 +19,68 @@
 
 #pragma once
 
+#include <mpp/detail/expr/expr_aliasing.hpp>
 #include <mpp/detail/expr/expr_binary_constant_op.hpp>
 #include <mpp/detail/expr/expr_binary_op.hpp>
 #include <mpp/detail/utility/algorithm_helpers.hpp>
 #include <mpp/matrix.hpp>
 
 #include <algorithm>
+#include <concepts>
 #include <cstddef>
+#include <type_traits>
+#include <utility>
 
 namespace mpp
 {
 	namespace detail
 	{
-		inline constexpr auto div_op = [](const auto& lhs,
-										   const auto& rhs,
-										   std::size_t row_index,
-										   std::size_t column_index) noexcept -> decltype(lhs(row_index, column_index) /
-																						  rhs) {
-			return lhs(row_index, column_index) / rhs;
+		inline constexpr auto div_op =
+			[](const auto& lhs, const auto& rhs, std::size_t row_index, std::size_t column_index) noexcept {
+				using constant_type = std::remove_cvref_t<decltype(rhs)>;
+				using value_type    = expr_common_value_t<expr_value_t<decltype(lhs)>, constant_type>;
+
+				return static_cast<value_type>(
+					static_cast<value_type>(lhs(row_index, column_index)) / static_cast<value_type>(rhs));
+			};
+
+		template<>
+		struct is_elementwise_op<std::remove_const_t<decltype(div_op)>> : std::true_type
+		{
 		};
 	} // namespace detail
 
-	template<typename Base, typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent>
-	[[nodiscard]] auto operator/(const detail::expr_base<Base, Value, RowsExtent, ColumnsExtent>& obj, Value constant)
-		-> detail::expr_binary_constant_op<RowsExtent,
-			ColumnsExtent,
-			detail::expr_base<Base, Value, RowsExtent, ColumnsExtent>,
-			Value,
-			decltype(detail::div_op)> // @TODO: ISSUE #20
+	// clang-format off
+	template<detail::expression Obj, typename Constant>
+		requires detail::expr_constant_of<Constant, detail::expr_value_t<Obj>>
+	[[nodiscard]] auto operator/(Obj&& obj, Constant constant)
+		-> detail::expr_binary_constant_op<detail::expr_rows_extent_v<Obj>,
+			detail::expr_columns_extent_v<Obj>,
+			detail::expr_operand_t<Obj>,
+			Constant,
+			std::remove_const_t<decltype(detail::div_op)>> // @TODO: ISSUE #20
 	{
-		return { obj, constant, obj.rows(), obj.columns(), detail::div_op };
+		const auto rows    = obj.rows();
+		const auto columns = obj.columns();
+
+		return { std::forward<Obj>(obj), constant, rows, columns, detail::div_op };
 	}
 
-	template<typename Base, typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent>
-	[[nodiscard]] auto operator/(Value constant, const detail::expr_base<Base, Value, RowsExtent, ColumnsExtent>& obj)
-		-> detail::expr_binary_constant_op<RowsExtent,
-			ColumnsExtent,
-			detail::expr_base<Base, Value, RowsExtent, ColumnsExtent>,
-			Value,
-			decltype(detail::div_op)> // @TODO: ISSUE #20
+	template<detail::expression Obj, typename Constant>
+		requires detail::expr_constant_of<Constant, detail::expr_value_t<Obj>>
+	[[nodiscard]] auto operator/(Constant constant, Obj&& obj)
+		-> detail::expr_binary_constant_op<detail::expr_rows_extent_v<Obj>,
+			detail::expr_columns_extent_v<Obj>,
+			detail::expr_operand_t<Obj>,
+			Constant,
+			std::remove_const_t<decltype(detail::div_op)>> // @TODO: ISSUE #20
 	{
-		return { obj, constant, obj.rows(), obj.columns(), detail::div_op };
+		const auto rows    = obj.rows();
+		const auto columns = obj.columns();
+
+		return { std::forward<Obj>(obj), constant, rows, columns, detail::div_op };
 	}
+	// clang-format on
 
 	template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent>
 	inline auto operator/=(matrix<Value, RowsExtent, ColumnsExtent>& obj, Value constant)
@@ -73,4 +93,15 @@ namespace mpp
 
 		return obj;
 	}
+
+	template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Layout>
+	requires(!std::is_const_v<Value>) inline auto operator/=(matrix_view<Value, RowsExtent, ColumnsExtent, Layout> obj,
+		Value constant) -> matrix_view<Value, RowsExtent, ColumnsExtent, Layout> // @TODO: ISSUE #20
+	{
+		std::ranges::transform(obj, obj.begin(), [&constant](const auto& elem) {
+			return elem / constant;
+		});
+
+		return obj;
+	}
 } // namespace mpp
@@ -19,86 +19,116 @@
 
 #pragma once
 
+#include <mpp/detail/expr/expr_aliasing.hpp>
 #include <mpp/detail/expr/expr_binary_constant_op.hpp>
 #include <mpp/detail/expr/expr_binary_op.hpp>
 #include <mpp/detail/utility/algorithm_helpers.hpp>
 #include <mpp/matrix.hpp>
 
 #include <algorithm>
+#include <concepts>
 #include <cstddef>
 #include <functional>
 #include <type_traits>
+#include <utility>
 
 namespace mpp
 {
 	namespace detail
 	{
 		inline constexpr auto mul_constant_op =
-			[](const auto& left,
-				const auto& right,
-				std::size_t row_index,
-				std::size_t col_index) noexcept -> decltype(left(row_index, col_index) * right) {
-			return left(row_index, col_index) * right;
+			[](const auto& left, const auto& right, std::size_t row_index, std::size_t col_index) noexcept {
+				using constant_type = std::remove_cvref_t<decltype(right)>;
+				using value_type    = expr_common_value_t<expr_value_t<decltype(left)>, constant_type>;
+
+				return static_cast<value_type>(
+					static_cast<value_type>(left(row_index, col_index)) * static_cast<value_type>(right));
+			};
+
+		template<>
+		struct is_elementwise_op<std::remove_const_t<decltype(mul_constant_op)>> : std::true_type
+		{
 		};
 
 		inline constexpr auto mul_op =
-			[](const auto& left, const auto& right, std::size_t row_index, std::size_t col_index) noexcept ->
-			typename std::decay_t<decltype(left)>::value_type {
-				using value_type = typename std::decay_t<decltype(left)>::value_type;
+			[](const auto& left, const auto& right, std::size_t row_index, std::size_t col_index) noexcept {
+				using value_type = expr_common_value_t<expr_value_t<decltype(left)>, expr_value_t<decltype(right)>>;
 
-				const auto left_columns = left.columns();
-				auto result             = value_type{};
-
-				for (auto index = std::size_t{}; index < left_columns; ++index)
+				// Products with diagonal matrices only scale the rows or columns of the other operand
+				if constexpr (diagonal_expression<decltype(left)>)
+				{
+					return static_cast<value_type>(static_cast<value_type>(left.diagonal(row_index)) *
+						static_cast<value_type>(right(row_index, col_index)));
+				}
+				else if constexpr (diagonal_expression<decltype(right)>)
 				{
-					result += left(row_index, index) * right(index, col_index);
+					return static_cast<value_type>(static_cast<value_type>(left(row_index, col_index)) *
+						static_cast<value_type>(right.diagonal(col_index)));
 				}
+				else
+				{
+					const auto left_columns = left.columns();
+					auto result             = value_type{};
+
+					for (auto index = std::size_t{}; index < left_columns; ++index)
+					{
+						const auto left_value  = static_cast<value_type>(left(row_index, index));
+						const auto right_value = static_cast<value_type>(right(index, col_index));
 
-				return result;
+						result = static_cast<value_type>(result + left_value * right_value);
+					}
+
+					return result;
+				}
 			};
 	} // namespace detail
 
-	template<typename Base, typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent>
-	[[nodiscard]] inline auto operator*(const detail::expr_base<Base, Value, RowsExtent, ColumnsExtent>& obj,
-		Value constant) noexcept -> detail::expr_binary_constant_op<RowsExtent,
-		ColumnsExtent,
-		detail::expr_base<Base, Value, RowsExtent, ColumnsExtent>,
-		Value,
-		decltype(detail::mul_constant_op)> // @TODO: ISSUE #20
+	// clang-format off
+	template<detail::expression Obj, typename Constant>
+		requires detail::expr_constant_of<Constant, detail::expr_value_t<Obj>>
+	[[nodiscard]] inline auto operator*(Obj&& obj, Constant constant) noexcept
+		-> detail::expr_binary_constant_op<detail::expr_rows_extent_v<Obj>,
+			detail::expr_columns_extent_v<Obj>,
+			detail::expr_operand_t<Obj>,
+			Constant,
+			std::remove_const_t<decltype(detail::mul_constant_op)>> // @TODO: ISSUE #20
 	{
-		return { obj, constant, obj.rows(), obj.columns(), detail::mul_constant_op };
+		const auto rows    = obj.rows();
+		const auto columns = obj.columns();
+
+		return { std::forward<Obj>(obj), constant, rows, columns, detail::mul_constant_op };
 	}
 
-	template<typename Base, typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent>
-	[[nodiscard]] inline auto operator*(Value constant,
-		const detail::expr_base<Base, Value, RowsExtent, ColumnsExtent>& obj)
-		-> detail::expr_binary_constant_op<RowsExtent,
-			ColumnsExtent,
-			detail::expr_base<Base, Value, RowsExtent, ColumnsExtent>,
-			Value,
-			decltype(detail::mul_constant_op)> // @TODO: ISSUE #20
+	template<detail::expression Obj, typename Constant>
+		requires detail::expr_constant_of<Constant, detail::expr_value_t<Obj>>
+	[[nodiscard]] inline auto operator*(Constant constant, Obj&& obj)
+		-> detail::expr_binary_constant_op<detail::expr_rows_extent_v<Obj>,
+			detail::expr_columns_extent_v<Obj>,
+			detail::expr_operand_t<Obj>,
+			Constant,
+			std::remove_const_t<decltype(detail::mul_constant_op)>> // @TODO: ISSUE #20
 	{
-		return { obj, constant, obj.rows(), obj.columns(), detail::mul_constant_op };
+		const auto rows    = obj.rows();
+		const auto columns = obj.columns();
+
+		return { std::forward<Obj>(obj), constant, rows, columns, detail::mul_constant_op };
 	}
 
-	template<typename LeftBase,
-		typename RightBase,
-		typename Value,
-		std::size_t LeftRowsExtent,
-		std::size_t LeftColumnsExtent,
-		std::size_t RightRowsExtent,
-		std::size_t RightColumnsExtent>
-	[[nodiscard]] inline auto operator*(
-		const detail::expr_base<LeftBase, Value, LeftRowsExtent, LeftColumnsExtent>& left,
-		const detail::expr_base<RightBase, Value, RightRowsExtent, RightColumnsExtent>& right)
-		-> detail::expr_binary_op<LeftRowsExtent,
-			RightColumnsExtent,
-			detail::expr_base<LeftBase, Value, LeftRowsExtent, LeftColumnsExtent>,
-			detail::expr_base<RightBase, Value, RightRowsExtent, RightColumnsExtent>,
-			decltype(detail::mul_op)> // @TODO: ISSUE #20
+	template<detail::expression Left, detail::expression Right>
+		requires detail::has_expr_common_value<detail::expr_value_t<Left>, detail::expr_value_t<Right>>
+	[[nodiscard]] inline auto operator*(Left&& left, Right&& right)
+		-> detail::expr_binary_op<detail::expr_rows_extent_v<Left>,
+			detail::expr_columns_extent_v<Right>,
+			detail::expr_operand_t<Left>,
+			detail::expr_operand_t<Right>,
+			std::remove_const_t<decltype(detail::mul_op)>> // @TODO: ISSUE #20
 	{
-		return { left, right, left.rows(), right.columns(), detail::mul_op };
+		const auto rows    = left.rows();
+		const auto columns = right.columns();
+
+		return { std::forward<Left>(left), std::forward<Right>(right), rows, columns, detail::mul_op };
 	}
+	// clang-format on
 
 	template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent>
 	inline auto operator*=(matrix<Value, RowsExtent, ColumnsExtent>& obj, Value constant)
@@ -108,4 +138,13 @@ namespace mpp
 
 		return obj;
 	}
+
+	template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Layout>
+	requires(!std::is_const_v<Value>) inline auto operator*=(matrix_view<Value, RowsExtent, ColumnsExtent, Layout> obj,
+		Value constant) -> matrix_view<Value, RowsExtent, ColumnsExtent, Layout> // @TODO: ISSUE #20
+	{
+		std::ranges::transform(obj, obj.begin(), std::bind_front(std::multiplies<>{}, constant));
+
+		return obj;
+	}
 } // namespace mpp
@@ -19,44 +19,54 @@
 
 #pragma once
 
+#include <mpp/detail/expr/expr_aliasing.hpp>
 #include <mpp/detail/expr/expr_binary_op.hpp>
 #include <mpp/detail/utility/algorithm_helpers.hpp>
+#include <mpp/detail/utility/buffer_manipulators.hpp>
 #include <mpp/detail/utility/utility.hpp>
 #include <mpp/matrix.hpp>
 
+#include <concepts>
 #include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace mpp
 {
 	namespace detail
 	{
-		inline constexpr auto sub_op = [](const auto& left,
-										   const auto& right,
-										   std::size_t row_index,
-										   std::size_t col_index) noexcept -> decltype(left(row_index, col_index) -
-																					   right(row_index, col_index)) {
-			return left(row_index, col_index) - right(row_index, col_index);
+		inline constexpr auto sub_op =
+			[](const auto& left, const auto& right, std::size_t row_index, std::size_t col_index) noexcept {
+				using value_type = expr_common_value_t<expr_value_t<decltype(left)>, expr_value_t<decltype(right)>>;
+
+				return static_cast<value_type>(static_cast<value_type>(left(row_index, col_index)) -
+					static_cast<value_type>(right(row_index, col_index)));
+			};
+
+		template<>
+		struct is_elementwise_op<std::remove_const_t<decltype(sub_op)>> : std::true_type
+		{
 		};
 	} // namespace detail
 
-	template<typename LeftBase,
-		typename RightBase,
-		typename Value,
-		std::size_t LeftRowsExtent,
-		std::size_t LeftColumnsExtent,
-		std::size_t RightRowsExtent,
-		std::size_t RightColumnsExtent>
-	[[nodiscard]] inline auto operator-(
-		const detail::expr_base<LeftBase, Value, LeftRowsExtent, LeftColumnsExtent>& left,
-		const detail::expr_base<RightBase, Value, RightRowsExtent, RightColumnsExtent>& right) noexcept
-		-> detail::expr_binary_op<detail::prefer_static_extent(LeftRowsExtent, RightRowsExtent),
-			detail::prefer_static_extent(LeftColumnsExtent, RightColumnsExtent),
-			detail::expr_base<LeftBase, Value, LeftRowsExtent, LeftColumnsExtent>,
-			detail::expr_base<RightBase, Value, RightRowsExtent, RightColumnsExtent>,
-			decltype(detail::sub_op)> // @TODO: ISSUE #20
+	// clang-format off
+	template<detail::expression Left, detail::expression Right>
+		requires detail::has_expr_common_value<detail::expr_value_t<Left>, detail::expr_value_t<Right>>
+	[[nodiscard]] inline auto operator-(Left&& left, Right&& right) noexcept
+		-> detail::expr_binary_op<detail::prefer_static_extent(detail::expr_rows_extent_v<Left>,
+									  detail::expr_rows_extent_v<Right>),
+			detail::prefer_static_extent(detail::expr_columns_extent_v<Left>, detail::expr_columns_extent_v<Right>),
+			detail::expr_operand_t<Left>,
+			detail::expr_operand_t<Right>,
+			std::remove_const_t<decltype(detail::sub_op)>> // @TODO: ISSUE #20
 	{
-		return { left, right, left.rows(), left.columns(), detail::sub_op };
+		const auto rows    = left.rows();
+		const auto columns = left.columns();
+
+		return { std::forward<Left>(left), std::forward<Right>(right), rows, columns, detail::sub_op };
 	}
+	// clang-format on
 
 	template<typename Value,
 		std::size_t LeftRowsExtent,
@@ -74,12 +84,13 @@ namespace mpp
 
 	template<typename Value,
 		typename Expr,
+		typename ExprValue,
 		std::size_t LeftRowsExtent,
 		std::size_t LeftColumnsExtent,
 		std::size_t RightRowsExtent,
 		std::size_t RightColumnsExtent>
 	inline auto operator-=(matrix<Value, LeftRowsExtent, LeftColumnsExtent>& left,
-		const detail::expr_base<Expr, Value, RightRowsExtent, RightColumnsExtent>& right)
+		const detail::expr_base<Expr, ExprValue, RightRowsExtent, RightColumnsExtent>& right)
 		-> matrix<Value, LeftRowsExtent, LeftColumnsExtent>& // @TODO: ISSUE #20
 	{
 		const auto rows    = left.rows();
@@ -89,7 +100,50 @@ namespace mpp
 		{
 			for (auto col = std::size_t{ 0 }; col < columns; ++col)
 			{
-				left(row, col) -= right(row, col);
+				using value_type = detail::expr_common_value_t<Value, ExprValue>;
+
+				left(row, col) = static_cast<Value>(static_cast<value_type>(left(row, col)) -
+					static_cast<value_type>(right(row, col)));
+			}
+		}
+
+		return left;
+	}
+
+	template<typename Value,
+		typename Expr,
+		typename ExprValue,
+		std::size_t LeftRowsExtent,
+		std::size_t LeftColumnsExtent,
+		std::size_t RightRowsExtent,
+		std::size_t RightColumnsExtent,
+		typename Layout>
+	requires(!std::is_const_v<Value>) inline auto operator-=(
+		matrix_view<Value, LeftRowsExtent, LeftColumnsExtent, Layout> left,
+		const detail::expr_base<Expr, ExprValue, RightRowsExtent, RightColumnsExtent>& right)
+		-> matrix_view<Value, LeftRowsExtent, LeftColumnsExtent, Layout> // @TODO: ISSUE #20
+	{
+		const auto rows    = left.rows();
+		const auto columns = left.columns();
+
+		if (detail::expr_reads_memory(right, left.data(), left.memory_end(), true))
+		{
+			// The right side reads elements of the view before they're updated (e.g. v -= transposed(v)), so it's
+			// evaluated into memory first
+			auto buffer = std::vector<ExprValue>{};
+			detail::eval_expr_into_buffer(buffer, rows, columns, right);
+
+			return left -= matrix_view<const ExprValue>{ buffer.data(), rows, columns };
+		}
+
+		for (auto row = std::size_t{ 0 }; row < rows; ++row)
+		{
+			for (auto col = std::size_t{ 0 }; col < columns; ++col)
+			{
+				using value_type = detail::expr_common_value_t<std::remove_const_t<Value>, ExprValue>;
+
+				left(row, col) = static_cast<Value>(static_cast<value_type>(left(row, col)) -
+					static_cast<value_type>(right(row, col)));
 			}
 		}
 
@@ -0,0 +1,93 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/detail/expr/expr_base.hpp>
+#include <mpp/detail/types/constraints.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace mpp::detail
+{
+	/**
+	 * Operations computing an element only from the elements of their operands at the same position. Anything not
+	 * specialized is assumed to read other positions (e.g. matrix products and transposed views)
+	 */
+	template<typename Op>
+	struct is_elementwise_op : std::false_type
+	{
+	};
+
+	[[nodiscard]] inline auto memory_overlaps(const void* first,
+		const void* last,
+		const void* other_first,
+		const void* other_last) noexcept -> bool // @TODO: ISSUE #20
+	{
+		// std::less gives a total order even for pointers into different objects
+		const auto less = std::less<const void*>{};
+
+		return less(first, other_last) && less(other_first, last);
+	}
+
+	/**
+	 * Whether evaluating an expression reads memory in [first, last), which is where the result is about to be
+	 * written. Reading the destination at the position being written is fine, so with same_index_allowed the
+	 * destination matrix itself doesn't count when it's only an operand of element-wise operations
+	 */
+	template<typename Expr, typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent>
+	[[nodiscard]] auto expr_reads_memory(const expr_base<Expr, Value, RowsExtent, ColumnsExtent>& expr,
+		const void* first,
+		const void* last,
+		bool same_index_allowed) noexcept -> bool // @TODO: ISSUE #20
+	{
+		const auto& obj = static_cast<const Expr&>(expr);
+
+		if constexpr (requires { obj.reads_memory(first, last, same_index_allowed); })
+		{
+			return obj.reads_memory(first, last, same_index_allowed);
+		}
+		else if constexpr (is_matrix<Expr>::value)
+		{
+			// Matrices own their buffers, so one overlapping the destination is the destination
+			const auto data = obj.data();
+
+			return !same_index_allowed && memory_overlaps(data, data + obj.size(), first, last);
+		}
+		else if constexpr (requires { obj.stride(); })
+		{
+			// Views can start anywhere in the destination, so any overlap counts. The strided rows (or columns) span
+			// at most stride() elements each
+			const auto data  = obj.data();
+			const auto lines = std::max(obj.rows(), obj.columns());
+
+			return obj.rows() != 0 && obj.columns() != 0 &&
+				memory_overlaps(data, data + lines * obj.stride(), first, last);
+		}
+		else
+		{
+			// Other leaves (e.g. sparse or structured matrices) have their own storage
+			return false;
+		}
+	}
+} // namespace mpp::detail
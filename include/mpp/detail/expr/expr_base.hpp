@@ -21,6 +21,8 @@
 
 #include <cstddef>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace mpp::detail
 {
@@ -70,4 +72,47 @@ namespace mpp::detail
 			return expr_obj()(row_index, col_index);
 		}
 	};
+
+	template<typename Expr, typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent>
+	auto is_expr_impl(const expr_base<Expr, Value, RowsExtent, ColumnsExtent>&) -> std::true_type;
+
+	auto is_expr_impl(...) -> std::false_type;
+
+	template<typename T>
+	concept expression = decltype(is_expr_impl(std::declval<const std::remove_cvref_t<T>&>()))::value;
+
+	template<expression Expr>
+	using expr_value_t = typename std::remove_cvref_t<Expr>::value_type;
+
+	template<expression Expr>
+	inline constexpr auto expr_rows_extent_v = std::remove_cvref_t<Expr>::rows_extent();
+
+	template<expression Expr>
+	inline constexpr auto expr_columns_extent_v = std::remove_cvref_t<Expr>::columns_extent();
+
+	/**
+	 * Value type of an expression mixing operands (or constants) of different value types. It is computed per element
+	 * inside the evaluation loop, so e.g. float and double operands never need a converted copy of either operand
+	 */
+	template<typename... Values>
+	using expr_common_value_t = std::common_type_t<Values...>;
+
+	template<typename... Values>
+	concept has_expr_common_value = requires
+	{
+		typename expr_common_value_t<Values...>;
+	};
+
+	template<typename Constant, typename Value>
+	concept expr_constant_of = !expression<Constant> && has_expr_common_value<Value, Constant>;
+
+	/**
+	 * How an expression object stores an operand passed as Expr&&. Lvalues are referenced, but rvalues (temporary
+	 * matrices and expression objects) are moved in and owned, so expressions built from temporaries can outlive the
+	 * full-expression that created them
+	 */
+	template<expression Expr>
+	using expr_operand_t = std::conditional_t<std::is_lvalue_reference_v<Expr>,
+		const std::remove_cvref_t<Expr>&,
+		std::remove_cvref_t<Expr>>;
 } // namespace mpp::detail
\ No newline at end of file
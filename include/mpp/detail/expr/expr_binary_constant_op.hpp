@@ -19,7 +19,9 @@
 
 #pragma once
 
+#include <mpp/detail/expr/expr_aliasing.hpp>
 #include <mpp/detail/expr/expr_base.hpp>
+#include <mpp/detail/utility/extent_storage.hpp>
 
 #include <cstddef>
 #include <stdexcept>
@@ -31,32 +33,34 @@ namespace mpp::detail
 	 * Binary expression object (one of the operands is a constant, so we have to store it
 	 * differently, which differs from expr_binary_op)
 	 */
-	template<std::size_t RowsExtent, std::size_t ColumnsExtent, typename Obj, typename Value, typename Op>
+	template<std::size_t RowsExtent, std::size_t ColumnsExtent, typename Obj, typename Constant, typename Op>
 	class [[nodiscard]] expr_binary_constant_op :
-		public expr_base<expr_binary_constant_op<RowsExtent, ColumnsExtent, Obj, Value, Op>,
-			Value,
+		public expr_base<expr_binary_constant_op<RowsExtent, ColumnsExtent, Obj, Constant, Op>,
+			expr_common_value_t<expr_value_t<Obj>, Constant>,
 			RowsExtent,
 			ColumnsExtent>
 	{
-		const Obj& obj_;
-		Value val_; // Store the constant by copy to handle literals
+		Obj obj_; // Either a reference (lvalue) or an owned value (rvalue moved in), see expr_operand_t
+		Constant val_; // Store the constant by copy to handle literals
 
-		const Op& op_;
+		// Operations are usually stateless lambdas, which then take no space
+		[[no_unique_address]] Op op_;
 
 		// "Knowing" the size of the resulting matrix allows performing validation on expression objects
-		std::size_t result_rows_;
-		std::size_t result_columns_;
+		[[no_unique_address]] rows_storage<RowsExtent> result_rows_;
+		[[no_unique_address]] columns_storage<ColumnsExtent> result_columns_;
 
 	public:
-		using value_type = Value;
+		using value_type = expr_common_value_t<expr_value_t<Obj>, Constant>;
 
-		expr_binary_constant_op(const Obj& obj,
-			Value val,
+		template<typename Operand>
+		expr_binary_constant_op(Operand&& obj,
+			Constant val,
 			std::size_t result_rows,
 			std::size_t result_columns,
-			const Op& op) noexcept // @TODO: ISSUE #20
+			Op op) noexcept // @TODO: ISSUE #20
 			:
-			obj_(obj),
+			obj_(std::forward<Operand>(obj)),
 			val_(val),
 			op_(op),
 			result_rows_(result_rows),
@@ -79,5 +83,14 @@ namespace mpp::detail
 		{
 			return op_(obj_, val_, row_index, col_index);
 		}
+
+		/**
+		 * Whether evaluating reads memory in [first, last), see expr_reads_memory
+		 */
+		[[nodiscard]] auto reads_memory(const void* first, const void* last, bool same_index_allowed) const noexcept
+			-> bool // @TODO: ISSUE #20
+		{
+			return expr_reads_memory(obj_, first, last, same_index_allowed && is_elementwise_op<Op>::value);
+		}
 	};
 } // namespace mpp::detail
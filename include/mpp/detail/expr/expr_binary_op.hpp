@@ -19,10 +19,13 @@
 
 #pragma once
 
+#include <mpp/detail/expr/expr_aliasing.hpp>
 #include <mpp/detail/expr/expr_base.hpp>
+#include <mpp/detail/utility/extent_storage.hpp>
 
 #include <cstddef>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
 namespace mpp::detail
@@ -33,31 +36,33 @@ namespace mpp::detail
 	template<std::size_t RowsExtent, std::size_t ColumnsExtent, typename Left, typename Right, typename Op>
 	class [[nodiscard]] expr_binary_op :
 		public expr_base<expr_binary_op<RowsExtent, ColumnsExtent, Left, Right, Op>,
-			typename Left::value_type,
+			expr_common_value_t<expr_value_t<Left>, expr_value_t<Right>>,
 			RowsExtent,
 			ColumnsExtent>
 	{
-		// Store both operands by reference to avoid copying them
-		const Left& left_;
-		const Right& right_;
+		// Operands are either references (lvalues) or owned values (rvalues moved in), see expr_operand_t
+		Left left_;
+		Right right_;
 
-		const Op& op_;
+		// Operations are usually stateless lambdas, which then take no space
+		[[no_unique_address]] Op op_;
 
 		// "Knowing" the size of the resulting matrix allows performing validation on expression objects
-		std::size_t result_rows_;
-		std::size_t result_columns_;
+		[[no_unique_address]] rows_storage<RowsExtent> result_rows_;
+		[[no_unique_address]] columns_storage<ColumnsExtent> result_columns_;
 
 	public:
-		using value_type = typename Left::value_type;
+		using value_type = expr_common_value_t<expr_value_t<Left>, expr_value_t<Right>>;
 
-		expr_binary_op(const Left& left,
-			const Right& right,
+		template<typename LeftOperand, typename RightOperand>
+		expr_binary_op(LeftOperand&& left,
+			RightOperand&& right,
 			std::size_t result_rows,
 			std::size_t result_columns,
-			const Op& op) noexcept // @TODO: ISSUE #20
+			Op op) noexcept // @TODO: ISSUE #20
 			:
-			left_(left),
-			right_(right),
+			left_(std::forward<LeftOperand>(left)),
+			right_(std::forward<RightOperand>(right)),
 			op_(op),
 			result_rows_(result_rows),
 			result_columns_(result_columns)
@@ -79,5 +84,17 @@ namespace mpp::detail
 		{
 			return op_(left_, right_, row_index, col_index);
 		}
+
+		/**
+		 * Whether evaluating reads memory in [first, last), see expr_reads_memory
+		 */
+		[[nodiscard]] auto reads_memory(const void* first, const void* last, bool same_index_allowed) const noexcept
+			-> bool // @TODO: ISSUE #20
+		{
+			const auto same_index = same_index_allowed && is_elementwise_op<Op>::value;
+
+			return expr_reads_memory(left_, first, last, same_index) ||
+				expr_reads_memory(right_, first, last, same_index);
+		}
 	};
 } // namespace mpp::detail
@@ -0,0 +1,92 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/detail/expr/expr_aliasing.hpp>
+#include <mpp/detail/expr/expr_base.hpp>
+#include <mpp/detail/utility/extent_storage.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace mpp::detail
+{
+	/**
+	 * Unary expression object (only one operand, e.g. views that remap the indices of the operand)
+	 */
+	template<std::size_t RowsExtent, std::size_t ColumnsExtent, typename Obj, typename Op>
+	class [[nodiscard]] expr_unary_op :
+		public expr_base<expr_unary_op<RowsExtent, ColumnsExtent, Obj, Op>,
+			expr_value_t<Obj>,
+			RowsExtent,
+			ColumnsExtent>
+	{
+		Obj obj_; // Either a reference (lvalue) or an owned value (rvalue moved in), see expr_operand_t
+
+		// Operations are usually stateless lambdas, which then take no space
+		[[no_unique_address]] Op op_;
+
+		// "Knowing" the size of the resulting matrix allows performing validation on expression objects
+		[[no_unique_address]] rows_storage<RowsExtent> result_rows_;
+		[[no_unique_address]] columns_storage<ColumnsExtent> result_columns_;
+
+	public:
+		using value_type = expr_value_t<Obj>;
+
+		template<typename Operand>
+		expr_unary_op(Operand&& obj,
+			std::size_t result_rows,
+			std::size_t result_columns,
+			Op op) noexcept // @TODO: ISSUE #20
+			:
+			obj_(std::forward<Operand>(obj)),
+			op_(op),
+			result_rows_(result_rows),
+			result_columns_(result_columns)
+		{
+		}
+
+		[[nodiscard]] auto rows() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return result_rows_;
+		}
+
+		[[nodiscard]] auto columns() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return result_columns_;
+		}
+
+		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) const noexcept
+			-> value_type // @TODO: ISSUE #20
+		{
+			return op_(obj_, row_index, col_index);
+		}
+
+		/**
+		 * Whether evaluating reads memory in [first, last), see expr_reads_memory
+		 */
+		[[nodiscard]] auto reads_memory(const void* first, const void* last, bool same_index_allowed) const noexcept
+			-> bool // @TODO: ISSUE #20
+		{
+			return expr_reads_memory(obj_, first, last, same_index_allowed && is_elementwise_op<Op>::value);
+		}
+	};
+} // namespace mpp::detail
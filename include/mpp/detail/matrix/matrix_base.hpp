@@ -19,22 +19,34 @@
 
 #pragma once
 
+#include <mpp/detail/expr/expr_aliasing.hpp>
 #include <mpp/detail/expr/expr_base.hpp>
 #include <mpp/detail/matrix/matrix_iterator.hpp>
 #include <mpp/detail/types/constraints.hpp>
 #include <mpp/detail/types/type_traits.hpp>
 #include <mpp/detail/utility/buffer_manipulators.hpp>
+#include <mpp/detail/utility/extent_storage.hpp>
 #include <mpp/detail/utility/utility.hpp>
 #include <mpp/utility/configuration.hpp>
 #include <mpp/utility/traits.hpp>
 
 #include <algorithm>
+#include <cassert>
+#include <concepts>
 #include <cstddef>
+#include <functional>
+#include <initializer_list>
 #include <iterator>
+#include <ranges>
 #include <type_traits>
+#include <utility>
 
 namespace mpp::detail
 {
+	struct row_stride_tag
+	{
+	};
+
 	/**
 	 * Base matrix class to store internal data and define common member functions
 	 */
@@ -49,19 +61,68 @@ namespace mpp::detail
 		using base = expr_base<Derived, Value, RowsExtent, ColumnsExtent>;
 
 	protected:
-		Buffer buffer_;
-		std::size_t rows_{ RowsExtent == dynamic ? std::size_t{} : RowsExtent };
-		std::size_t columns_{ ColumnsExtent == dynamic ? std::size_t{} : ColumnsExtent };
+		// Mutable so that const accessors handing out the elements as a whole can move padded rows together first
+		mutable Buffer buffer_;
+		// Static extents take no space
+		[[no_unique_address]] rows_storage<RowsExtent> rows_{};
+		[[no_unique_address]] columns_storage<ColumnsExtent> columns_{};
+		// Distance between the first elements of two consecutive rows in the buffer. Appending columns leaves spare
+		// columns at the end of every row so that the next ones don't move every row again, so it can be bigger than
+		// the column count until the elements are accessed as a whole (data, iterators, flat indices, ...)
+		[[no_unique_address]] mutable extent_storage<ColumnsExtent, row_stride_tag> row_stride_{};
 
 		template<typename... Args>
 		matrix_base(std::size_t rows, std::size_t columns, Args&&... args) noexcept(
 			std::is_nothrow_constructible_v<Buffer, Args...>) :
 			buffer_(std::forward<Args>(args)...),
 			rows_{ rows },
-			columns_{ columns } // @TODO: ISSUE #20
+			columns_{ columns },
+			row_stride_{ columns } // @TODO: ISSUE #20
+		{
+		}
+
+		// The buffer is default-initialized rather than value-initialized, so static buffers of arithmetic values are
+		// left uninitialized
+		matrix_base(uninitialized_tag, std::size_t rows, std::size_t columns) noexcept(
+			std::is_nothrow_default_constructible_v<Buffer>) :
+			rows_{ rows },
+			columns_{ columns },
+			row_stride_{ columns } // @TODO: ISSUE #20
 		{
 		}
 
+		[[nodiscard]] auto has_spare_columns() const noexcept -> bool // @TODO: ISSUE #20
+		{
+			return row_stride_ != columns_;
+		}
+
+		/**
+		 * Moves the rows back together if columns were appended since the last time, so that the buffer holds exactly
+		 * rows * columns elements in row-major order again
+		 */
+		void compact() const noexcept // @TODO: ISSUE #20
+		{
+			if constexpr (ColumnsExtent == dynamic)
+			{
+				if (has_spare_columns())
+				{
+					const auto elements = scoped_buffer_data(buffer_);
+					const auto stride   = static_cast<std::size_t>(row_stride_);
+					const auto columns  = static_cast<std::size_t>(columns_);
+
+					// Every row moves towards the front, so moving them from the first one never overwrites a row that
+					// hasn't been moved yet
+					for (auto row = std::size_t{ 1 }; row < rows_; ++row)
+					{
+						std::move(elements + row * stride, elements + row * stride + columns, elements + row * columns);
+					}
+
+					buffer_.resize(rows_ * columns);
+					row_stride_ = columns;
+				}
+			}
+		}
+
 		void assign_and_insert_from_2d_range(auto&& range_2d)
 		{
 			// Preconditions:
@@ -88,8 +149,9 @@ namespace mpp::detail
 			}
 
 			// Assign all elements (until the need to insert for dynamic matrices)
-			const auto min_rows = (std::min)(range_rows, rows_);
-			auto buffer_begin   = buffer_.begin();
+			const auto min_rows = (std::min)(range_rows, static_cast<std::size_t>(rows_));
+			auto buffer_begin   = scoped_buffer_data(buffer_);
+			auto assigned_rows  = min_rows;
 
 			for (auto row = std::size_t{}; row < min_rows; ++row)
 			{
@@ -177,7 +239,7 @@ namespace mpp::detail
 								});
 						}
 
-						rows_ = ++row; // Use the inserter loop to insert rest of the elements
+						assigned_rows = ++row; // Use the inserter loop to insert rest of the elements
 						++range_begin;
 
 						break;
@@ -193,7 +255,7 @@ namespace mpp::detail
 			{
 				const auto buffer_back_inserter = std::back_inserter(buffer_);
 
-				for (auto row = rows_; row < range_rows; ++row)
+				for (auto row = assigned_rows; row < range_rows; ++row)
 				{
 					if constexpr (range_has_same_value_type)
 					{
@@ -226,8 +288,9 @@ namespace mpp::detail
 				}
 			}
 
-			rows_    = range_rows;
-			columns_ = range_columns;
+			rows_       = range_rows;
+			columns_    = range_columns;
+			row_stride_ = range_columns;
 		}
 
 		void assign_and_insert_from_1d_range(std::size_t rows, std::size_t columns, auto&& range)
@@ -250,7 +313,7 @@ namespace mpp::detail
 			const auto max_elements_to_assign = (std::min)(range_size, buffer_size);
 			const auto assign_begin           = std::ranges::begin(range);
 			const auto assign_end             = assign_begin + static_cast<difference_type>(max_elements_to_assign);
-			const auto buffer_begin           = buffer_.begin();
+			const auto buffer_begin           = scoped_buffer_data(buffer_);
 
 			// Try to assign the all elements it can
 			if constexpr (range_has_same_value_type)
@@ -267,7 +330,7 @@ namespace mpp::detail
 			else
 			{
 				// @TODO: Check if this *really* is perfect forwarding values
-				std::transform(assign_begin, assign_end, buffer_.begin(), [](auto&& value) -> decltype(auto) {
+				std::transform(assign_begin, assign_end, buffer_begin, [](auto&& value) -> decltype(auto) {
 					return static_cast<Value>(std::forward<decltype(value)>(value));
 				});
 			}
@@ -303,8 +366,24 @@ namespace mpp::detail
 				}
 			}
 
-			rows_    = rows;
-			columns_ = columns;
+			rows_       = rows;
+			columns_    = columns;
+			row_stride_ = columns;
+		}
+
+		void assign_from_expression_unchecked(std::size_t rows,
+			std::size_t columns,
+			const auto& expr) // @TODO: ISSUE #20
+		{
+			// Preconditions:
+			// The expression doesn't read the elements of this matrix at indices other than the one being written (e.g.
+			// this matrix as an operand of a matrix product)
+
+			eval_expr_into_buffer(buffer_, rows, columns, expr);
+
+			rows_       = rows;
+			columns_    = columns;
+			row_stride_ = columns;
 		}
 
 	public:
@@ -334,114 +413,136 @@ namespace mpp::detail
 
 		[[nodiscard]] auto data() noexcept -> pointer // @TODO: ISSUE #20
 		{
-			return buffer_.data();
+			compact();
+			return aligned_buffer_data(buffer_);
 		}
 
 		[[nodiscard]] auto data() const noexcept -> const_pointer // @TODO: ISSUE #20
 		{
-			return buffer_.data();
+			compact();
+			return aligned_buffer_data(std::as_const(buffer_));
 		}
 
 		[[nodiscard]] auto begin() noexcept -> iterator // @TODO: ISSUE #20
 		{
+			compact();
 			return iterator(buffer_.begin(), columns_);
 		}
 
 		[[nodiscard]] auto begin() const noexcept -> const_iterator // @TODO: ISSUE #20
 		{
-			return const_iterator(buffer_.cbegin(), columns_);
+			compact();
+			return const_iterator(std::as_const(buffer_).cbegin(), columns_);
 		}
 
 		[[nodiscard]] auto end() noexcept -> iterator // @TODO: ISSUE #20
 		{
+			compact();
 			return iterator(buffer_.end(), columns_);
 		}
 
 		[[nodiscard]] auto end() const noexcept -> const_iterator // @TODO: ISSUE #20
 		{
-			return const_iterator(buffer_.cend(), columns_);
+			compact();
+			return const_iterator(std::as_const(buffer_).cend(), columns_);
 		}
 
 		[[nodiscard]] auto rbegin() noexcept -> reverse_iterator // @TODO: ISSUE #20
 		{
+			compact();
 			return reverse_iterator(buffer_.rbegin(), columns_);
 		}
 
 		[[nodiscard]] auto rbegin() const noexcept -> const_reverse_iterator // @TODO: ISSUE #20
 		{
-			return const_reverse_iterator(buffer_.crbegin(), columns_);
+			compact();
+			return const_reverse_iterator(std::as_const(buffer_).crbegin(), columns_);
 		}
 
 		[[nodiscard]] auto rend() noexcept -> reverse_iterator // @TODO: ISSUE #20
 		{
+			compact();
 			return reverse_iterator(buffer_.rend(), columns_);
 		}
 
 		[[nodiscard]] auto rend() const noexcept -> const_reverse_iterator // @TODO: ISSUE #20
 		{
-			return const_reverse_iterator(buffer_.crend(), columns_);
+			compact();
+			return const_reverse_iterator(std::as_const(buffer_).crend(), columns_);
 		}
 
 		[[nodiscard]] auto cbegin() noexcept -> const_iterator // @TODO: ISSUE #20
 		{
+			compact();
 			return const_iterator(buffer_.cbegin(), columns_);
 		}
 
 		[[nodiscard]] auto cbegin() const noexcept -> const_iterator // @TODO: ISSUE #20
 		{
-			return const_iterator(buffer_.cbegin(), columns_);
+			compact();
+			return const_iterator(std::as_const(buffer_).cbegin(), columns_);
 		}
 
 		[[nodiscard]] auto cend() noexcept -> const_iterator // @TODO: ISSUE #20
 		{
+			compact();
 			return const_iterator(buffer_.cend(), columns_);
 		}
 
 		[[nodiscard]] auto cend() const noexcept -> const_iterator // @TODO: ISSUE #20
 		{
-			return const_iterator(buffer_.cend(), columns_);
+			compact();
+			return const_iterator(std::as_const(buffer_).cend(), columns_);
 		}
 
 		[[nodiscard]] auto crbegin() noexcept -> const_reverse_iterator // @TODO: ISSUE #20
 		{
+			compact();
 			return const_reverse_iterator(buffer_.crbegin(), columns_);
 		}
 
 		[[nodiscard]] auto crbegin() const noexcept -> const_reverse_iterator // @TODO: ISSUE #20
 		{
-			return const_reverse_iterator(buffer_.crbegin(), columns_);
+			compact();
+			return const_reverse_iterator(std::as_const(buffer_).crbegin(), columns_);
 		}
 
 		[[nodiscard]] auto crend() noexcept -> const_reverse_iterator // @TODO: ISSUE #20
 		{
+			compact();
 			return const_reverse_iterator(buffer_.crend(), columns_);
 		}
 
 		[[nodiscard]] auto crend() const noexcept -> const_reverse_iterator // @TODO: ISSUE #20
 		{
-			return const_reverse_iterator(buffer_.crend(), columns_);
+			compact();
+			return const_reverse_iterator(std::as_const(buffer_).crend(), columns_);
 		}
 
 		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) noexcept(
-			noexcept(buffer_[index_2d_to_1d(columns_, row_index, col_index)])) -> reference // @TODO: ISSUE #20
+			noexcept(buffer_[index_2d_to_1d(row_stride_, row_index, col_index)])) -> reference // @TODO: ISSUE #20
 		{
-			return buffer_[index_2d_to_1d(columns_, row_index, col_index)];
+			return buffer_[index_2d_to_1d(row_stride_, row_index, col_index)];
 		}
 
-		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) const noexcept(
-			noexcept(buffer_[index_2d_to_1d(columns_, row_index, col_index)])) -> const_reference // @TODO: ISSUE #20
+		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) const
+			noexcept(noexcept(std::as_const(buffer_)[index_2d_to_1d(row_stride_, row_index, col_index)]))
+				-> const_reference // @TODO: ISSUE #20
 		{
-			return buffer_[index_2d_to_1d(columns_, row_index, col_index)];
+			return std::as_const(buffer_)[index_2d_to_1d(row_stride_, row_index, col_index)];
 		}
 
 		[[nodiscard]] auto operator[](std::size_t index) noexcept(noexcept(buffer_[index])) -> reference
 		{
+			compact();
 			return buffer_[index];
 		}
 
-		[[nodiscard]] auto operator[](std::size_t index) const noexcept(noexcept(buffer_[index])) -> const_reference
+		[[nodiscard]] auto operator[](std::size_t index) const noexcept(noexcept(std::as_const(buffer_)[index]))
+			-> const_reference
 		{
-			return buffer_[index];
+			compact();
+			return std::as_const(buffer_)[index];
 		}
 
 		[[nodiscard]] auto rows() const noexcept -> std::size_t // @TODO: ISSUE #20
@@ -461,22 +562,24 @@ namespace mpp::detail
 
 		[[nodiscard]] auto front() const noexcept -> const_reference // @TODO: ISSUE #20
 		{
-			return buffer_.front();
+			return std::as_const(buffer_).front();
 		}
 
 		[[nodiscard]] auto back() noexcept -> reference // @TODO: ISSUE #20
 		{
+			compact();
 			return buffer_.back();
 		}
 
 		[[nodiscard]] auto back() const noexcept -> const_reference // @TODO: ISSUE #20
 		{
-			return buffer_.back();
+			compact();
+			return std::as_const(buffer_).back();
 		}
 
 		[[nodiscard]] auto size() const noexcept -> std::size_t // @TODO: ISSUE #20
 		{
-			return buffer_.size();
+			return rows_ * columns_;
 		}
 
 		[[nodiscard]] auto max_size() const noexcept -> std::size_t // @TODO: ISSUE #20
@@ -486,7 +589,7 @@ namespace mpp::detail
 
 		[[nodiscard]] auto empty() const noexcept -> bool // @TODO: ISSUE #20
 		{
-			return buffer_.empty();
+			return size() == 0;
 		}
 
 		template<range_2d_with_value_type_convertible_to<Value> Range2D>
@@ -508,6 +611,74 @@ namespace mpp::detail
 		}
 		// clang-format on
 
+		template<typename Expr,
+			std::convertible_to<Value> ExprValue,
+			std::size_t ExprRowsExtent,
+			std::size_t ExprColumnsExtent>
+		auto operator=(const expr_base<Expr, ExprValue, ExprRowsExtent, ExprColumnsExtent>& expr)
+			-> matrix_base& // @TODO: ISSUE #20
+		{
+			assert(RowsExtent == dynamic || expr.rows() == RowsExtent);
+			assert(ColumnsExtent == dynamic || expr.columns() == ColumnsExtent);
+
+			// The expression may read this matrix, which has to be laid out like it's about to be written
+			compact();
+
+			const auto first = std::as_const(buffer_).data();
+			const auto last  = first + buffer_.size();
+
+			if (expr_reads_memory(expr, first, last, true))
+			{
+				// The expression reads elements of this matrix that would be overwritten before being read (e.g.
+				// a = a * b), so it's evaluated into a new buffer which then replaces the current one
+				auto buffer = [this]() {
+					if constexpr (is_vector<Buffer>::value)
+					{
+						return Buffer(buffer_.get_allocator());
+					}
+					else
+					{
+						return Buffer{};
+					}
+				}();
+
+				eval_expr_into_buffer(buffer, expr.rows(), expr.columns(), expr);
+
+				buffer_     = std::move(buffer);
+				rows_       = expr.rows();
+				columns_    = expr.columns();
+				row_stride_ = expr.columns();
+			}
+			else
+			{
+				assign_from_expression_unchecked(expr.rows(), expr.columns(), expr);
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Gives the elements (row-major) away without copying them. Matrices with dynamic extents are left empty
+		 */
+		[[nodiscard]] auto release() noexcept(std::is_nothrow_move_constructible_v<Buffer>)
+			-> Buffer // @TODO: ISSUE #20
+		{
+			compact();
+
+			auto buffer = std::move(buffer_);
+
+			if constexpr (is_vector<Buffer>::value)
+			{
+				buffer_.clear();
+			}
+
+			rows_       = RowsExtent == dynamic ? 0 : RowsExtent;
+			columns_    = ColumnsExtent == dynamic ? 0 : ColumnsExtent;
+			row_stride_ = columns_;
+
+			return buffer;
+		}
+
 		void swap(matrix_base& right) noexcept // @TODO: ISSUE #20
 		{
 			// Don't swap with the same object
@@ -517,6 +688,7 @@ namespace mpp::detail
 
 				swap(rows_, right.rows_);
 				swap(columns_, right.columns_);
+				swap(row_stride_, right.row_stride_);
 				swap(buffer_, right.buffer_);
 			}
 		}
@@ -544,24 +716,6 @@ namespace mpp::detail
 		{
 		}
 
-		void initialize_from_expression_unchecked(std::size_t rows,
-			std::size_t columns,
-			const auto& expr) // @TODO: ISSUE #20
-		{
-			base::rows_    = rows;
-			base::columns_ = columns;
-
-			base::buffer_.reserve(rows * columns);
-
-			for (auto row = std::size_t{}; row < base::rows_; ++row)
-			{
-				for (auto column = std::size_t{}; column < base::columns_; ++column)
-				{
-					base::buffer_.push_back(expr(row, column));
-				}
-			}
-		}
-
 		template<typename Callable>
 		void initialize_buffer_from_callable_unchecked(std::size_t rows,
 			std::size_t columns,
@@ -577,6 +731,56 @@ namespace mpp::detail
 			}
 		}
 
+		void reserve_for_append(std::size_t total_size) // @TODO: ISSUE #20
+		{
+			// Geometric growth even for buffers whose reserve allocates exactly what's asked, to keep appending one row
+			// or column at a time amortized constant
+			if (const auto capacity = base::buffer_.capacity(); total_size > capacity)
+			{
+				base::buffer_.reserve((std::max)(total_size, capacity * 2));
+			}
+		}
+
+		void set_row_stride(std::size_t new_stride) // @TODO: ISSUE #20
+		{
+			// Preconditions:
+			// new_stride > row_stride_
+
+			// Rows are moved to their new place from the last one, so no row is overwritten before being moved
+			const auto old_stride = static_cast<std::size_t>(base::row_stride_);
+			const auto columns    = base::columns();
+			const auto rows       = base::rows();
+
+			reserve_for_append(rows * new_stride);
+			base::buffer_.resize(rows * new_stride);
+
+			const auto elements = scoped_buffer_data(base::buffer_);
+
+			for (auto row = rows; row-- > 1;)
+			{
+				const auto old_row_begin = elements + static_cast<typename base::difference_type>(row * old_stride);
+				const auto new_row_begin = elements + static_cast<typename base::difference_type>(row * new_stride);
+
+				std::move_backward(old_row_begin,
+					old_row_begin + static_cast<typename base::difference_type>(columns),
+					new_row_begin + static_cast<typename base::difference_type>(columns));
+			}
+
+			base::row_stride_ = new_stride;
+		}
+
+		void make_room_for_columns(std::size_t new_columns) // @TODO: ISSUE #20
+		{
+			// Every row gets spare columns at its end, growing geometrically like the buffer itself, so only one
+			// append in a while moves the rows and appending columns one at a time is amortized O(rows) per column
+			if (const auto stride = static_cast<std::size_t>(base::row_stride_); new_columns > stride)
+			{
+				set_row_stride((std::max)(new_columns, stride * 2));
+			}
+
+			base::columns_ = new_columns;
+		}
+
 	public:
 		using base::operator=;
 
@@ -587,9 +791,225 @@ namespace mpp::detail
 
 		void clear() noexcept // @TODO: ISSUE #20
 		{
-			base::rows_    = 0;
-			base::columns_ = 0;
+			// Static extents are kept, so e.g. rows can still be appended to a cleared matrix with dynamic rows
+			base::rows_       = RowsExtent == dynamic ? 0 : RowsExtent;
+			base::columns_    = ColumnsExtent == dynamic ? 0 : ColumnsExtent;
+			base::row_stride_ = base::columns_;
 			base::buffer_.clear();
 		}
+
+		// clang-format off
+		/**
+		 * Appends a row at the bottom in amortized constant time (per element). The first row appended to an empty
+		 * fully dynamic matrix sets its column count
+		 */
+		template<range_1d_with_value_type_convertible_to<Value> Range>
+			requires(RowsExtent == dynamic)
+		void append_row(Range&& row) // @TODO: ISSUE #20
+		{
+			const auto row_size = static_cast<std::size_t>(std::ranges::distance(row));
+
+			if constexpr (ColumnsExtent == dynamic)
+			{
+				if (base::rows_ == 0)
+				{
+					base::columns_ = row_size;
+				}
+			}
+
+			assert(row_size == base::columns_);
+
+			base::compact();
+			reserve_for_append(base::buffer_.size() + row_size);
+
+			for (auto&& value : row)
+			{
+				base::buffer_.push_back(static_cast<Value>(std::forward<decltype(value)>(value)));
+			}
+
+			++base::rows_;
+		}
+
+		template<std::convertible_to<Value> InitializerListValue>
+			requires(RowsExtent == dynamic)
+		void append_row(std::initializer_list<InitializerListValue> row) // @TODO: ISSUE #20
+		{
+			append_row(std::views::all(row));
+		}
+
+		template<range_2d_with_value_type_convertible_to<Value> Range2D>
+			requires(RowsExtent == dynamic)
+		void append_rows(Range2D&& rows) // @TODO: ISSUE #20
+		{
+			for (auto&& row : rows)
+			{
+				append_row(row);
+			}
+		}
+
+		template<typename Expr,
+			std::convertible_to<Value> ExprValue,
+			std::size_t ExprRowsExtent,
+			std::size_t ExprColumnsExtent>
+			requires(RowsExtent == dynamic)
+		void append_rows(const expr_base<Expr, ExprValue, ExprRowsExtent, ExprColumnsExtent>& expr) // @TODO: ISSUE #20
+		{
+			const auto expr_rows    = expr.rows();
+			const auto expr_columns = expr.columns();
+
+			if constexpr (ColumnsExtent == dynamic)
+			{
+				if (base::rows_ == 0)
+				{
+					base::columns_ = expr_columns;
+				}
+			}
+
+			assert(expr_columns == base::columns_);
+
+			// Nothing is reallocated past this point, so the expression can read this matrix (e.g. appending a
+			// matrix to itself)
+			base::compact();
+			reserve_for_append(base::buffer_.size() + expr_rows * expr_columns);
+
+			for (auto row = std::size_t{}; row < expr_rows; ++row)
+			{
+				for (auto column = std::size_t{}; column < expr_columns; ++column)
+				{
+					base::buffer_.push_back(static_cast<Value>(expr(row, column)));
+				}
+			}
+
+			base::rows_ += expr_rows;
+		}
+
+		/**
+		 * Appends a column on the right in amortized O(rows) time. Rows keep spare columns at their end while columns
+		 * are appended, and are only moved back together the first time the elements are accessed as a whole (data,
+		 * iterators, ...), even through a const reference, so finish appending before sharing the matrix between
+		 * threads. The first column appended to an empty fully dynamic matrix sets its row count
+		 */
+		template<range_1d_with_value_type_convertible_to<Value> Range>
+			requires(ColumnsExtent == dynamic)
+		void append_column(Range&& column) // @TODO: ISSUE #20
+		{
+			const auto column_size = static_cast<std::size_t>(std::ranges::distance(column));
+
+			if constexpr (RowsExtent == dynamic)
+			{
+				if (base::columns_ == 0)
+				{
+					base::rows_ = column_size;
+				}
+			}
+
+			assert(column_size == base::rows_);
+
+			const auto new_column = base::columns();
+
+			make_room_for_columns(new_column + 1);
+
+			const auto elements = scoped_buffer_data(base::buffer_);
+			auto row            = std::size_t{};
+
+			for (auto&& value : column)
+			{
+				elements[index_2d_to_1d(base::row_stride_, row++, new_column)] =
+					static_cast<Value>(std::forward<decltype(value)>(value));
+			}
+		}
+
+		template<std::convertible_to<Value> InitializerListValue>
+			requires(ColumnsExtent == dynamic)
+		void append_column(std::initializer_list<InitializerListValue> column) // @TODO: ISSUE #20
+		{
+			append_column(std::views::all(column));
+		}
+
+		/**
+		 * Appends the columns of an expression on the right, in amortized O(rows) time per column like append_column.
+		 * The expression can't refer to this matrix. The first columns appended to an empty fully dynamic matrix set
+		 * its row count
+		 */
+		template<typename Expr,
+			std::convertible_to<Value> ExprValue,
+			std::size_t ExprRowsExtent,
+			std::size_t ExprColumnsExtent>
+			requires(ColumnsExtent == dynamic)
+		void append_columns(
+			const expr_base<Expr, ExprValue, ExprRowsExtent, ExprColumnsExtent>& expr) // @TODO: ISSUE #20
+		{
+			const auto expr_rows    = expr.rows();
+			const auto expr_columns = expr.columns();
+
+			if constexpr (RowsExtent == dynamic)
+			{
+				if (base::columns_ == 0)
+				{
+					base::rows_ = expr_rows;
+				}
+			}
+
+			assert(expr_rows == base::rows_);
+
+			const auto first_new_column = base::columns();
+
+			make_room_for_columns(base::columns_ + expr_columns);
+
+			const auto elements = scoped_buffer_data(base::buffer_);
+
+			for (auto row = std::size_t{}; row < expr_rows; ++row)
+			{
+				for (auto column = std::size_t{}; column < expr_columns; ++column)
+				{
+					elements[index_2d_to_1d(base::row_stride_, row, first_new_column + column)] =
+						static_cast<Value>(expr(row, column));
+				}
+			}
+		}
+		// clang-format on
+
+		/**
+		 * Reserves room for the given number of rows. An empty fully dynamic matrix only gets its column count from
+		 * the first row appended, so the columns to reserve for are passed along instead
+		 */
+		void reserve_rows(std::size_t rows, std::size_t columns = 0) requires(RowsExtent == dynamic) // @TODO: ISSUE #20
+		{
+			const auto current_columns = base::columns();
+
+			assert(current_columns == 0 || columns == 0 || columns == current_columns);
+
+			base::buffer_.reserve(rows * (current_columns == 0 ? columns : current_columns));
+		}
+
+		/**
+		 * Reserves room for the given number of columns, taking the rows to reserve for like reserve_rows takes
+		 * columns
+		 */
+		void reserve_columns(std::size_t columns, std::size_t rows = 0)
+			requires(ColumnsExtent == dynamic) // @TODO: ISSUE #20
+		{
+			const auto current_rows = base::rows();
+
+			assert(current_rows == 0 || rows == 0 || rows == current_rows);
+
+			base::buffer_.reserve(columns * (current_rows == 0 ? rows : current_rows));
+
+			// Rows that already exist get their spare columns right away, so appending up to that many columns never
+			// moves them again
+			if (current_rows != 0 && columns > base::row_stride_)
+			{
+				set_row_stride(columns);
+			}
+		}
+
+		/**
+		 * Frees the memory reserved for appending
+		 */
+		void shrink_to_fit() // @TODO: ISSUE #20
+		{
+			base::compact();
+			base::buffer_.shrink_to_fit();
+		}
 	};
 } // namespace mpp::detail
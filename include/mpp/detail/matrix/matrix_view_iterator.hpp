@@ -0,0 +1,155 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace mpp::detail
+{
+	/**
+	 * Row-major iterator over the elements of a matrix view. Rows of a view don't have to be adjacent in memory (and
+	 * aren't at all with column-major views), so it keeps the position as a flattened row-major index and maps it to an
+	 * element through the layout and the stride of the view
+	 *
+	 * Satisfies random_access_iterator
+	 */
+	template<typename Value, typename Layout>
+	class matrix_view_iterator
+	{
+		Value* data_            = nullptr;
+		std::ptrdiff_t index_   = 0;
+		std::ptrdiff_t columns_ = 0;
+		std::ptrdiff_t stride_  = 0;
+
+	public:
+		using value_type        = std::remove_const_t<Value>;
+		using difference_type   = std::ptrdiff_t;
+		using pointer           = Value*;
+		using reference         = Value&;
+		using iterator_category = std::random_access_iterator_tag;
+
+		matrix_view_iterator(Value* data, difference_type index, std::size_t columns, std::size_t stride) noexcept :
+			data_(data),
+			index_(index),
+			columns_(static_cast<difference_type>(columns)),
+			stride_(static_cast<difference_type>(stride)) // @TODO: ISSUE #20
+		{
+		}
+
+		matrix_view_iterator() noexcept = default; // @TODO: ISSUE #20
+
+		[[nodiscard]] auto operator*() const noexcept -> reference // @TODO: ISSUE #20
+		{
+			const auto row    = static_cast<std::size_t>(index_ / columns_);
+			const auto column = static_cast<std::size_t>(index_ % columns_);
+
+			return data_[Layout::index(static_cast<std::size_t>(stride_), row, column)];
+		}
+
+		[[nodiscard]] auto operator->() const noexcept -> pointer // @TODO: ISSUE #20
+		{
+			return &**this;
+		}
+
+		[[nodiscard]] auto operator[](difference_type n) const noexcept -> reference // @TODO: ISSUE #20
+		{
+			return *(*this + n);
+		}
+
+		auto operator++() noexcept -> matrix_view_iterator& // @TODO: ISSUE #20
+		{
+			++index_;
+			return *this;
+		}
+
+		auto operator++(int) noexcept -> matrix_view_iterator // @TODO: ISSUE #20
+		{
+			auto old = *this;
+
+			++index_;
+			return old;
+		}
+
+		auto operator--() noexcept -> matrix_view_iterator& // @TODO: ISSUE #20
+		{
+			--index_;
+			return *this;
+		}
+
+		auto operator--(int) noexcept -> matrix_view_iterator // @TODO: ISSUE #20
+		{
+			auto old = *this;
+
+			--index_;
+			return old;
+		}
+
+		auto operator+=(difference_type n) noexcept -> matrix_view_iterator& // @TODO: ISSUE #20
+		{
+			index_ += n;
+			return *this;
+		}
+
+		auto operator-=(difference_type n) noexcept -> matrix_view_iterator& // @TODO: ISSUE #20
+		{
+			index_ -= n;
+			return *this;
+		}
+
+		[[nodiscard]] friend auto operator+(matrix_view_iterator iter, difference_type n) noexcept
+			-> matrix_view_iterator // @TODO: ISSUE #20
+		{
+			return iter += n;
+		}
+
+		[[nodiscard]] friend auto operator+(difference_type n, matrix_view_iterator iter) noexcept
+			-> matrix_view_iterator // @TODO: ISSUE #20
+		{
+			return iter += n;
+		}
+
+		[[nodiscard]] friend auto operator-(matrix_view_iterator iter, difference_type n) noexcept
+			-> matrix_view_iterator // @TODO: ISSUE #20
+		{
+			return iter -= n;
+		}
+
+		[[nodiscard]] auto operator-(const matrix_view_iterator& right) const noexcept
+			-> difference_type // @TODO: ISSUE #20
+		{
+			return index_ - right.index_;
+		}
+
+		[[nodiscard]] auto operator==(const matrix_view_iterator& right) const noexcept -> bool // @TODO: ISSUE #20
+		{
+			return index_ == right.index_;
+		}
+
+		[[nodiscard]] auto operator<=>(const matrix_view_iterator& right) const noexcept
+			-> std::strong_ordering // @TODO: ISSUE #20
+		{
+			return index_ <=> right.index_;
+		}
+	};
+} // namespace mpp::detail
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <type_traits>
 #include <vector>
 
@@ -33,4 +34,36 @@ namespace mpp::detail
 	struct is_vector<std::vector<T, Allocator>> : std::true_type
 	{
 	};
+
+	template<typename Allocator>
+	struct allocator_alignment : std::integral_constant<std::size_t, alignof(typename Allocator::value_type)>
+	{
+	};
+
+	template<typename Allocator>
+		requires requires { Allocator::alignment; }
+	struct allocator_alignment<Allocator> : std::integral_constant<std::size_t, Allocator::alignment>
+	{
+	};
+
+	/**
+	 * Alignment of the first element of a buffer. Over-aligned buffers (and allocators) advertise it with a static
+	 * alignment member
+	 */
+	template<typename Buffer>
+	struct buffer_alignment : std::integral_constant<std::size_t, alignof(typename Buffer::value_type)>
+	{
+	};
+
+	template<typename Buffer>
+		requires requires { Buffer::alignment; }
+	struct buffer_alignment<Buffer> : std::integral_constant<std::size_t, Buffer::alignment>
+	{
+	};
+
+	template<typename Buffer>
+		requires(!requires { Buffer::alignment; } && requires { typename Buffer::allocator_type; })
+	struct buffer_alignment<Buffer> : allocator_alignment<typename Buffer::allocator_type>
+	{
+	};
 } // namespace mpp::detail
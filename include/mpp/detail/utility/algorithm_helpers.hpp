@@ -20,13 +20,21 @@
 #pragma once
 
 #include <mpp/detail/types/algo_types.hpp>
+#include <mpp/detail/types/type_traits.hpp>
 #include <mpp/detail/utility/utility.hpp>
+#include <mpp/matrix/matrix_view.hpp>
+#include <mpp/memory/default_init_allocator.hpp>
+#include <mpp/memory/workspace.hpp>
 #include <mpp/utility/comparison.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <compare>
 #include <cstddef>
+#include <iterator>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace mpp::detail
 {
@@ -36,6 +44,204 @@ namespace mpp::detail
 		Mat::columns_extent(),
 		typename std::allocator_traits<typename Mat::allocator_type>::template rebind_alloc<T>>;
 
+	/**
+	 * Buffer for temporaries of algorithms. Buffers that would allocate draw from a workspace instead, and static
+	 * buffers stay as they are because they don't allocate in the first place. Elements are default-initialized, as
+	 * most temporaries are completely overwritten before being read
+	 */
+	template<typename Buffer>
+	using scratch_buffer_t = std::conditional_t<is_vector<Buffer>::value,
+		std::vector<typename Buffer::value_type,
+			default_init_allocator<typename Buffer::value_type, workspace_allocator<typename Buffer::value_type>>>,
+		Buffer>;
+
+	template<typename Buffer>
+	[[nodiscard]] auto make_scratch_buffer(workspace& arena) -> scratch_buffer_t<Buffer> // @TODO: ISSUE #20
+	{
+		if constexpr (is_vector<Buffer>::value)
+		{
+			return scratch_buffer_t<Buffer>(typename scratch_buffer_t<Buffer>::allocator_type{ arena });
+		}
+		else
+		{
+			return Buffer{};
+		}
+	}
+
+	/**
+	 * Buffer for the elements an algorithm returns. When the returned matrix stores the type the elements are computed
+	 * in, they're written straight into a buffer of its own type (and allocator), which matrix_from_buffer adopts.
+	 * Otherwise they're computed in a scratch buffer and converted at the end
+	 */
+	template<typename To, typename Buffer>
+	using result_buffer_t = std::conditional_t<std::is_same_v<typename To::value_type, typename Buffer::value_type>,
+		typename To::buffer_type,
+		scratch_buffer_t<Buffer>>;
+
+	template<typename To, typename Buffer>
+	[[nodiscard]] auto make_result_buffer(workspace& arena) -> result_buffer_t<To, Buffer> // @TODO: ISSUE #20
+	{
+		if constexpr (std::is_same_v<result_buffer_t<To, Buffer>, typename To::buffer_type>)
+		{
+			return typename To::buffer_type{};
+		}
+		else
+		{
+			return make_scratch_buffer<Buffer>(arena);
+		}
+	}
+
+	/**
+	 * Copies the elements of a matrix (or a view) into an empty buffer in row-major order. Dynamic buffers get them
+	 * appended, so nothing is value-initialized first whatever the allocator
+	 */
+	template<typename Buffer>
+	void copy_into_buffer(Buffer& buffer, const auto& obj) // @TODO: ISSUE #20
+	{
+		if constexpr (is_vector<Buffer>::value)
+		{
+			buffer.reserve(obj.size());
+			std::ranges::copy(obj, std::back_inserter(buffer));
+		}
+		else
+		{
+			std::ranges::copy(obj, buffer.begin());
+		}
+	}
+
+	/**
+	 * Matrix which is about to be completely overwritten, so its elements don't have to be initialized
+	 */
+	template<typename To>
+	[[nodiscard]] auto make_uninitialized_matrix(std::size_t rows, std::size_t columns) -> To // @TODO: ISSUE #20
+	{
+		constexpr auto rows_extent    = To::rows_extent();
+		constexpr auto columns_extent = To::columns_extent();
+
+		if constexpr (rows_extent == dynamic && columns_extent == dynamic)
+		{
+			return To{ rows, columns, uninitialized };
+		}
+		else if constexpr (rows_extent == dynamic)
+		{
+			return To{ rows, uninitialized };
+		}
+		else if constexpr (columns_extent == dynamic)
+		{
+			return To{ columns, uninitialized };
+		}
+		else
+		{
+			return To{ uninitialized };
+		}
+	}
+
+	/**
+	 * Matrix whose elements are given in row-major order by a callable. Dynamic buffers get every element appended as
+	 * it's generated, so nothing is value-initialized first even when the allocator can't default-initialize (e.g.
+	 * std::allocator), unlike make_uninitialized_matrix
+	 */
+	template<typename To, typename Callable>
+	[[nodiscard]] auto make_generated_matrix(std::size_t rows, std::size_t columns, Callable& callable)
+		-> To // @TODO: ISSUE #20
+	{
+		constexpr auto rows_extent    = To::rows_extent();
+		constexpr auto columns_extent = To::columns_extent();
+
+		if constexpr (rows_extent == dynamic && columns_extent == dynamic)
+		{
+			return To{ rows, columns, callable };
+		}
+		else if constexpr (rows_extent == dynamic)
+		{
+			return To{ rows, callable };
+		}
+		else if constexpr (columns_extent == dynamic)
+		{
+			return To{ columns, callable };
+		}
+		else
+		{
+			return To{ callable };
+		}
+	}
+
+	/**
+	 * Matrix holding the elements of a row-major buffer. Buffers of the matrix's own buffer type are adopted rather
+	 * than copied
+	 */
+	template<typename To, typename Buffer>
+	[[nodiscard]] auto matrix_from_buffer(std::size_t rows, std::size_t columns, Buffer&& buffer)
+		-> To // @TODO: ISSUE #20
+	{
+		constexpr auto rows_extent    = To::rows_extent();
+		constexpr auto columns_extent = To::columns_extent();
+
+		if constexpr (!std::is_same_v<Buffer, typename To::buffer_type>)
+		{
+			return To{ rows, columns, std::forward<Buffer>(buffer) };
+		}
+		else if constexpr (rows_extent == dynamic && columns_extent == dynamic)
+		{
+			return To{ rows, columns, adopt, std::move(buffer) };
+		}
+		else if constexpr (rows_extent == dynamic)
+		{
+			return To{ rows, adopt, std::move(buffer) };
+		}
+		else if constexpr (columns_extent == dynamic)
+		{
+			return To{ columns, adopt, std::move(buffer) };
+		}
+		else
+		{
+			return To{ adopt, std::move(buffer) };
+		}
+	}
+
+	/**
+	 * Flattened row-major indexing into the elements of a matrix view, whose rows don't have to be adjacent
+	 */
+	template<typename Value, typename Layout>
+	class strided_elements
+	{
+		Value* data_;
+		std::size_t columns_;
+		std::size_t stride_;
+
+	public:
+		strided_elements(Value* data, std::size_t columns, std::size_t stride) noexcept :
+			data_(data),
+			columns_(columns),
+			stride_(stride) // @TODO: ISSUE #20
+		{
+		}
+
+		[[nodiscard]] auto operator[](std::size_t index) const noexcept -> Value& // @TODO: ISSUE #20
+		{
+			return data_[Layout::index(stride_, index / columns_, index % columns_)];
+		}
+	};
+
+	/**
+	 * Elements of a matrix or a matrix view, indexable in flattened row-major order
+	 */
+	[[nodiscard]] inline auto flat_elements(const auto& obj) noexcept // @TODO: ISSUE #20
+	{
+		if constexpr (is_matrix_view<std::remove_cvref_t<decltype(obj)>>::value)
+		{
+			using view_t = std::remove_cvref_t<decltype(obj)>;
+
+			return strided_elements<typename view_t::element_type, typename view_t::layout_type>{ obj.data(),
+				obj.columns(),
+				obj.stride() };
+		}
+		else
+		{
+			return obj.data();
+		}
+	}
+
 	[[nodiscard]] constexpr auto prefer_static_extent(std::size_t left_extent, std::size_t right_extent) noexcept
 		-> std::size_t
 	{
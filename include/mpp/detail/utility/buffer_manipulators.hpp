@@ -23,9 +23,67 @@
 #include <mpp/detail/utility/utility.hpp>
 
 #include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
 
 namespace mpp::detail
 {
+	/**
+	 * Mutable pointer to the first element for code that's done with it before the buffer is copied, which keeps the
+	 * elements of buffers tracking what their accessors hand out (cow_buffer) shareable
+	 */
+	template<typename Buffer>
+	[[nodiscard]] auto scoped_buffer_data(Buffer& buffer) // @TODO: ISSUE #20
+	{
+		if constexpr (requires { buffer.scoped_data(); })
+		{
+			return buffer.scoped_data();
+		}
+		else
+		{
+			return buffer.data();
+		}
+	}
+
+	template<typename Buffer, typename Pointer>
+	[[nodiscard]] auto assume_buffer_alignment(const Buffer& buffer, Pointer data) noexcept // @TODO: ISSUE #20
+	{
+		if constexpr (std::is_pointer_v<Pointer>)
+		{
+			if (buffer.size() == 0)
+			{
+				return data;
+			}
+
+			return std::assume_aligned<buffer_alignment<Buffer>::value>(data);
+		}
+		else
+		{
+			return data;
+		}
+	}
+
+	/**
+	 * Pointer to the first element which lets the compiler assume the alignment of the buffer, so over-aligned buffers
+	 * get aligned loads and stores in the loops using it. Empty buffers can have a null data(), which is returned as
+	 * is since assuming the alignment of a null pointer is undefined
+	 */
+	template<typename Buffer>
+	[[nodiscard]] auto aligned_buffer_data(Buffer& buffer) noexcept(noexcept(buffer.data())) // @TODO: ISSUE #20
+	{
+		return assume_buffer_alignment(std::as_const(buffer), buffer.data());
+	}
+
+	/**
+	 * aligned_buffer_data for code that's done with the pointer before the buffer is copied, see scoped_buffer_data
+	 */
+	template<typename Buffer>
+	[[nodiscard]] auto aligned_scoped_buffer_data(Buffer& buffer) // @TODO: ISSUE #20
+	{
+		return assume_buffer_alignment(std::as_const(buffer), scoped_buffer_data(buffer));
+	}
+
 	template<typename Buffer, typename InitializerValue>
 	void allocate_buffer_if_vector(Buffer& buffer,
 		std::size_t rows,
@@ -40,6 +98,23 @@ namespace mpp::detail
 		}
 	}
 
+	/**
+	 * Resizes without an initializer value, so buffers whose allocator default-initializes (e.g.
+	 * default_init_allocator) skip the fill
+	 */
+	template<typename Buffer>
+	void allocate_uninitialized_buffer_if_vector(Buffer& buffer,
+		std::size_t rows,
+		std::size_t columns) // @TODO: ISSUE #20
+	{
+		constexpr auto is_vec = is_vector<Buffer>::value;
+
+		if constexpr (is_vec)
+		{
+			buffer.resize(rows * columns);
+		}
+	}
+
 	template<typename Buffer>
 	void reserve_buffer_if_vector(Buffer& buffer, std::size_t rows, std::size_t columns) // @TODO: ISSUE #20
 	{
@@ -63,9 +138,37 @@ namespace mpp::detail
 			buffer.resize(rows * columns, zero_value);
 		}
 
+		const auto elements = scoped_buffer_data(buffer);
+
 		for (auto index = std::size_t{}; index < rows; ++index)
 		{
-			buffer[index_2d_to_1d(columns, index, index)] = one_value;
+			elements[index_2d_to_1d(columns, index, index)] = one_value;
+		}
+	}
+
+	template<typename Buffer>
+	void eval_expr_into_buffer(Buffer& buffer,
+		std::size_t rows,
+		std::size_t columns,
+		const auto& expr) // @TODO: ISSUE #20
+	{
+		// Resizing within the capacity never reallocates, so evaluating into a buffer that has held a result at least
+		// this big before doesn't touch the allocator
+		if constexpr (is_vector<Buffer>::value)
+		{
+			buffer.resize(rows * columns);
+		}
+
+		const auto elements = aligned_scoped_buffer_data(buffer);
+
+		for (auto row = std::size_t{}, index = std::size_t{}; row < rows; ++row)
+		{
+			for (auto column = std::size_t{}; column < columns; ++column)
+			{
+				// Elements are converted one at a time, so evaluating e.g. a double expression into a float matrix
+				// never materializes a converted copy
+				elements[index++] = static_cast<typename Buffer::value_type>(expr(row, column));
+			}
 		}
 	}
 } // namespace mpp::detail
\ No newline at end of file
@@ -0,0 +1,106 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/detail/utility/public.hpp>
+
+#include <cassert>
+#include <cstddef>
+
+namespace mpp::detail
+{
+	struct rows_tag
+	{
+	};
+
+	struct columns_tag
+	{
+	};
+
+	/**
+	 * Row or column count of an object with the given extent. Dynamic extents store the count, static ones are empty
+	 * and always hold the extent, so with [[no_unique_address]] they take no space. The tag keeps the row and column
+	 * counts distinct types, which both have to be for the two of them to take no space
+	 */
+	template<std::size_t Extent, typename Tag>
+	class extent_storage
+	{
+		std::size_t value_;
+
+	public:
+		constexpr extent_storage(std::size_t value = 0) noexcept : value_(value) {} // @TODO: ISSUE #20
+
+		constexpr operator std::size_t() const noexcept // @TODO: ISSUE #20
+		{
+			return value_;
+		}
+
+		constexpr auto operator=(std::size_t value) noexcept -> extent_storage& // @TODO: ISSUE #20
+		{
+			value_ = value;
+
+			return *this;
+		}
+
+		constexpr auto operator+=(std::size_t value) noexcept -> extent_storage& // @TODO: ISSUE #20
+		{
+			value_ += value;
+
+			return *this;
+		}
+
+		constexpr auto operator++() noexcept -> extent_storage& // @TODO: ISSUE #20
+		{
+			++value_;
+
+			return *this;
+		}
+	};
+
+	template<std::size_t Extent, typename Tag>
+		requires(Extent != dynamic)
+	class extent_storage<Extent, Tag>
+	{
+	public:
+		constexpr extent_storage([[maybe_unused]] std::size_t value = Extent) noexcept // @TODO: ISSUE #20
+		{
+			assert(value == Extent);
+		}
+
+		constexpr operator std::size_t() const noexcept // @TODO: ISSUE #20
+		{
+			return Extent;
+		}
+
+		constexpr auto operator=([[maybe_unused]] std::size_t value) noexcept -> extent_storage& // @TODO: ISSUE #20
+		{
+			assert(value == Extent);
+
+			return *this;
+		}
+	};
+
+	template<std::size_t Extent>
+	using rows_storage = extent_storage<Extent, rows_tag>;
+
+	template<std::size_t Extent>
+	using columns_storage = extent_storage<Extent, columns_tag>;
+} // namespace mpp::detail
@@ -33,4 +33,23 @@ namespace mpp
 	};
 
 	inline constexpr auto identity = identity_tag{};
+
+	/**
+	 * Requests a matrix whose elements are left uninitialized when the buffer allows it, for results that are
+	 * completely overwritten right after construction
+	 */
+	struct uninitialized_tag
+	{
+	};
+
+	inline constexpr auto uninitialized = uninitialized_tag{};
+
+	/**
+	 * Requests a matrix that takes over an existing buffer (moved in) instead of copying its elements
+	 */
+	struct adopt_tag
+	{
+	};
+
+	inline constexpr auto adopt = adopt_tag{};
 } // namespace mpp
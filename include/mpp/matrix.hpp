@@ -19,7 +19,17 @@
 
 #pragma once
 
+#include <mpp/matrix/banded_matrix.hpp>
+#include <mpp/matrix/bit_matrix.hpp>
+#include <mpp/matrix/column_major_matrix.hpp>
+#include <mpp/matrix/constant_matrix.hpp>
+#include <mpp/matrix/csr_matrix.hpp>
+#include <mpp/matrix/diagonal_matrix.hpp>
 #include <mpp/matrix/dynamic_columns.hpp>
 #include <mpp/matrix/dynamic_rows.hpp>
 #include <mpp/matrix/fully_dynamic.hpp>
-#include <mpp/matrix/fully_static.hpp>
\ No newline at end of file
+#include <mpp/matrix/fully_static.hpp>
+#include <mpp/matrix/mapped_matrix.hpp>
+#include <mpp/matrix/matrix_view.hpp>
+#include <mpp/matrix/padded_matrix.hpp>
+#include <mpp/matrix/symmetric_matrix.hpp>
\ No newline at end of file
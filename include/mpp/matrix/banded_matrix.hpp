@@ -0,0 +1,237 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/detail/expr/expr_base.hpp>
+#include <mpp/detail/types/constraints.hpp>
+#include <mpp/detail/utility/extent_storage.hpp>
+#include <mpp/detail/utility/public.hpp>
+#include <mpp/utility/configuration.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <vector>
+
+namespace mpp
+{
+	namespace detail
+	{
+		struct lower_bandwidth_tag
+		{
+		};
+
+		struct upper_bandwidth_tag
+		{
+		};
+	} // namespace detail
+
+	/**
+	 * Square matrix whose non-zero elements are within LowerBandwidth diagonals below and UpperBandwidth diagonals
+	 * above the main diagonal. Only the band is stored, row after row, so a row takes lower + upper + 1 elements
+	 * whatever the size of the matrix. The bandwidths are dynamic (given at runtime) or static like extents
+	 *
+	 * Elements outside the band read as zero, so it can be used in expressions and converted to a dense matrix (e.g.
+	 * mpp::matrix<double>{ banded }). Elements inside the band are modified through band()
+	 */
+	template<detail::arithmetic Value,
+		std::size_t LowerBandwidth = dynamic,
+		std::size_t UpperBandwidth = dynamic,
+		typename Allocator         = typename configuration<override>::allocator<Value>>
+	class banded_matrix :
+		public detail::
+			expr_base<banded_matrix<Value, LowerBandwidth, UpperBandwidth, Allocator>, Value, dynamic, dynamic>
+	{
+		std::vector<Value, Allocator> buffer_;
+		std::size_t size_{};
+		[[no_unique_address]] detail::extent_storage<LowerBandwidth, detail::lower_bandwidth_tag> lower_{};
+		[[no_unique_address]] detail::extent_storage<UpperBandwidth, detail::upper_bandwidth_tag> upper_{};
+
+		[[nodiscard]] auto band_index(std::size_t row_index, std::size_t col_index) const noexcept
+			-> std::size_t // @TODO: ISSUE #20
+		{
+			assert(in_band(row_index, col_index));
+
+			return row_index * row_width() + col_index + lower_ - row_index;
+		}
+
+	public:
+		using value_type      = Value;
+		using allocator_type  = Allocator;
+		using size_type       = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference       = Value&;
+		using const_reference = const Value&;
+
+		banded_matrix() = default;
+
+		/**
+		 * Matrix of the given size with static bandwidths, where every element of the band is value
+		 */
+		explicit banded_matrix(std::size_t size, const Value& value = Value{}, const Allocator& allocator = Allocator{})
+			requires(LowerBandwidth != dynamic && UpperBandwidth != dynamic) :
+			banded_matrix(size, LowerBandwidth, UpperBandwidth, value, allocator) // @TODO: ISSUE #20
+		{
+		}
+
+		banded_matrix(std::size_t size,
+			std::size_t lower_bandwidth,
+			std::size_t upper_bandwidth,
+			const Value& value         = Value{},
+			const Allocator& allocator = Allocator{}) :
+			buffer_(size * (lower_bandwidth + upper_bandwidth + 1), value, allocator),
+			size_(size),
+			lower_(lower_bandwidth),
+			upper_(upper_bandwidth) // @TODO: ISSUE #20
+		{
+		}
+
+		/**
+		 * Keeps the band of a square dense matrix (or an expression object), elements outside of it are dropped
+		 */
+		template<typename Expr,
+			std::convertible_to<Value> ExprValue,
+			std::size_t ExprRowsExtent,
+			std::size_t ExprColumnsExtent>
+		banded_matrix(const detail::expr_base<Expr, ExprValue, ExprRowsExtent, ExprColumnsExtent>& expr,
+			std::size_t lower_bandwidth,
+			std::size_t upper_bandwidth,
+			const Allocator& allocator = Allocator{}) :
+			banded_matrix(expr.rows(), lower_bandwidth, upper_bandwidth, Value{}, allocator) // @TODO: ISSUE #20
+		{
+			assert(expr.rows() == expr.columns());
+
+			for (auto row = std::size_t{}; row < size_; ++row)
+			{
+				for (auto column = first_column(row); column < last_column(row); ++column)
+				{
+					band(row, column) = static_cast<Value>(expr(row, column));
+				}
+			}
+		}
+
+		template<typename Expr,
+			std::convertible_to<Value> ExprValue,
+			std::size_t ExprRowsExtent,
+			std::size_t ExprColumnsExtent>
+		explicit banded_matrix(const detail::expr_base<Expr, ExprValue, ExprRowsExtent, ExprColumnsExtent>& expr,
+			const Allocator& allocator = Allocator{}) requires(LowerBandwidth != dynamic && UpperBandwidth != dynamic) :
+			banded_matrix(expr, LowerBandwidth, UpperBandwidth, allocator) // @TODO: ISSUE #20
+		{
+		}
+
+		[[nodiscard]] auto rows() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return size_;
+		}
+
+		[[nodiscard]] auto columns() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return size_;
+		}
+
+		[[nodiscard]] auto lower_bandwidth() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return lower_;
+		}
+
+		[[nodiscard]] auto upper_bandwidth() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return upper_;
+		}
+
+		/**
+		 * Number of stored elements of a row, including the ones sticking out of the matrix in the first and last rows
+		 */
+		[[nodiscard]] auto row_width() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return lower_ + upper_ + 1;
+		}
+
+		/**
+		 * First column of the band in a row
+		 */
+		[[nodiscard]] auto first_column(std::size_t row_index) const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return row_index > lower_ ? row_index - lower_ : 0;
+		}
+
+		/**
+		 * One past the last column of the band in a row
+		 */
+		[[nodiscard]] auto last_column(std::size_t row_index) const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return std::min(row_index + upper_ + 1, size_);
+		}
+
+		[[nodiscard]] auto in_band(std::size_t row_index, std::size_t col_index) const noexcept
+			-> bool // @TODO: ISSUE #20
+		{
+			return row_index < size_ && col_index >= first_column(row_index) && col_index < last_column(row_index);
+		}
+
+		/**
+		 * Band stored row after row, row_width() elements per row. Element (row, column) is at
+		 * row * row_width() + column + lower_bandwidth() - row
+		 */
+		[[nodiscard]] auto data() noexcept -> Value* // @TODO: ISSUE #20
+		{
+			return buffer_.data();
+		}
+
+		[[nodiscard]] auto data() const noexcept -> const Value* // @TODO: ISSUE #20
+		{
+			return buffer_.data();
+		}
+
+		[[nodiscard]] auto get_allocator() const noexcept -> Allocator // @TODO: ISSUE #20
+		{
+			return buffer_.get_allocator();
+		}
+
+		[[nodiscard]] auto band(std::size_t row_index, std::size_t col_index) noexcept
+			-> reference // @TODO: ISSUE #20
+		{
+			return buffer_[band_index(row_index, col_index)];
+		}
+
+		[[nodiscard]] auto band(std::size_t row_index, std::size_t col_index) const noexcept
+			-> const_reference // @TODO: ISSUE #20
+		{
+			return buffer_[band_index(row_index, col_index)];
+		}
+
+		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) const noexcept
+			-> Value // @TODO: ISSUE #20
+		{
+			assert(row_index < size_ && col_index < size_);
+
+			return in_band(row_index, col_index) ? band(row_index, col_index) : Value{};
+		}
+	};
+
+	/**
+	 * Matrix with only the main diagonal and the diagonals right above and below it
+	 */
+	template<detail::arithmetic Value, typename Allocator = typename configuration<override>::allocator<Value>>
+	using tridiagonal_matrix = banded_matrix<Value, 1, 1, Allocator>;
+} // namespace mpp
@@ -0,0 +1,290 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/detail/expr/expr_base.hpp>
+#include <mpp/detail/utility/public.hpp>
+#include <mpp/utility/configuration.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace mpp
+{
+	/**
+	 * Requests arithmetic over GF(2) (addition is XOR) instead of boolean arithmetic (addition is OR)
+	 */
+	struct gf2_tag
+	{
+	};
+
+	inline constexpr auto gf2 = gf2_tag{};
+
+	/**
+	 * Matrix of booleans packed 64 per word, row after row. Every row starts on a new word and the bits past the last
+	 * column of a row are always zero, so whole words can be combined and counted with word-level operations
+	 *
+	 * The value type is bool, which isn't arithmetic, so this isn't an mpp::matrix, but it's still an expression:
+	 * converting it to a dense matrix (e.g. mpp::matrix<int>{ bits }) and reading elements work as usual. Element-wise
+	 * AND, OR and XOR are done a word at a time, and products go through mpp::product
+	 */
+	template<typename Allocator = typename configuration<override>::allocator<std::uint64_t>>
+	class bit_matrix : public detail::expr_base<bit_matrix<Allocator>, bool, dynamic, dynamic>
+	{
+	public:
+		using word_type = std::uint64_t;
+
+		static constexpr auto bits_per_word = std::size_t{ 64 };
+
+	private:
+		std::vector<word_type, Allocator> words_;
+		std::size_t rows_{};
+		std::size_t columns_{};
+		std::size_t words_per_row_{};
+
+		[[nodiscard]] auto last_word_mask() const noexcept -> word_type // @TODO: ISSUE #20
+		{
+			const auto used_bits = columns_ % bits_per_word;
+
+			return used_bits == 0 ? ~word_type{} : (word_type{ 1 } << used_bits) - 1;
+		}
+
+		template<typename Op>
+		auto combine(const bit_matrix& right, Op op) -> bit_matrix& // @TODO: ISSUE #20
+		{
+			assert(rows_ == right.rows_ && columns_ == right.columns_);
+
+			std::ranges::transform(words_, right.words_, words_.begin(), op);
+
+			return *this;
+		}
+
+	public:
+		using value_type      = bool;
+		using allocator_type  = Allocator;
+		using size_type       = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+		bit_matrix() = default;
+
+		bit_matrix(std::size_t rows,
+			std::size_t columns,
+			bool value                 = false,
+			const Allocator& allocator = Allocator{}) :
+			words_(allocator),
+			rows_(rows),
+			columns_(columns),
+			words_per_row_((columns + bits_per_word - 1) / bits_per_word) // @TODO: ISSUE #20
+		{
+			words_.assign(rows_ * words_per_row_, value ? ~word_type{} : word_type{});
+
+			if (value && columns_ % bits_per_word != 0)
+			{
+				for (auto row = std::size_t{}; row < rows_; ++row)
+				{
+					row_data(row)[words_per_row_ - 1] &= last_word_mask();
+				}
+			}
+		}
+
+		bit_matrix(std::initializer_list<std::initializer_list<bool>> init_2d,
+			const Allocator& allocator = Allocator{}) :
+			bit_matrix(init_2d.size(),
+				init_2d.size() == 0 ? 0 : init_2d.begin()->size(),
+				false,
+				allocator) // @TODO: ISSUE #20
+		{
+			auto row = std::size_t{};
+
+			for (const auto& init_row : init_2d)
+			{
+				assert(init_row.size() == columns_);
+
+				auto column = std::size_t{};
+
+				for (const auto value : init_row)
+				{
+					set(row, column++, value);
+				}
+
+				++row;
+			}
+		}
+
+		/**
+		 * Packs a dense matrix (or an expression object), where every element that isn't zero becomes true
+		 */
+		template<typename Expr, typename ExprValue, std::size_t ExprRowsExtent, std::size_t ExprColumnsExtent>
+		explicit bit_matrix(const detail::expr_base<Expr, ExprValue, ExprRowsExtent, ExprColumnsExtent>& expr,
+			const Allocator& allocator = Allocator{}) :
+			bit_matrix(expr.rows(), expr.columns(), false, allocator) // @TODO: ISSUE #20
+		{
+			for (auto row = std::size_t{}; row < rows_; ++row)
+			{
+				for (auto column = std::size_t{}; column < columns_; ++column)
+				{
+					set(row, column, expr(row, column) != ExprValue{});
+				}
+			}
+		}
+
+		[[nodiscard]] auto rows() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return rows_;
+		}
+
+		[[nodiscard]] auto columns() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return columns_;
+		}
+
+		[[nodiscard]] auto words_per_row() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return words_per_row_;
+		}
+
+		[[nodiscard]] auto data() noexcept -> word_type* // @TODO: ISSUE #20
+		{
+			return words_.data();
+		}
+
+		[[nodiscard]] auto data() const noexcept -> const word_type* // @TODO: ISSUE #20
+		{
+			return words_.data();
+		}
+
+		[[nodiscard]] auto row_data(std::size_t row_index) noexcept -> word_type* // @TODO: ISSUE #20
+		{
+			assert(row_index < rows_);
+
+			return words_.data() + row_index * words_per_row_;
+		}
+
+		[[nodiscard]] auto row_data(std::size_t row_index) const noexcept -> const word_type* // @TODO: ISSUE #20
+		{
+			assert(row_index < rows_);
+
+			return words_.data() + row_index * words_per_row_;
+		}
+
+		[[nodiscard]] auto get_allocator() const noexcept -> Allocator // @TODO: ISSUE #20
+		{
+			return words_.get_allocator();
+		}
+
+		/**
+		 * Number of true elements
+		 */
+		[[nodiscard]] auto count() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			auto result = std::size_t{};
+
+			for (const auto word : words_)
+			{
+				result += static_cast<std::size_t>(std::popcount(word));
+			}
+
+			return result;
+		}
+
+		void set(std::size_t row_index, std::size_t col_index, bool value = true) noexcept // @TODO: ISSUE #20
+		{
+			assert(col_index < columns_);
+
+			auto& word      = row_data(row_index)[col_index / bits_per_word];
+			const auto mask = word_type{ 1 } << (col_index % bits_per_word);
+
+			word = value ? word | mask : word & ~mask;
+		}
+
+		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) const noexcept
+			-> bool // @TODO: ISSUE #20
+		{
+			assert(col_index < columns_);
+
+			return ((row_data(row_index)[col_index / bits_per_word] >> (col_index % bits_per_word)) & 1) != 0;
+		}
+
+		auto operator&=(const bit_matrix& right) -> bit_matrix& // @TODO: ISSUE #20
+		{
+			return combine(right, [](word_type left, word_type right) { return left & right; });
+		}
+
+		auto operator|=(const bit_matrix& right) -> bit_matrix& // @TODO: ISSUE #20
+		{
+			return combine(right, [](word_type left, word_type right) { return left | right; });
+		}
+
+		auto operator^=(const bit_matrix& right) -> bit_matrix& // @TODO: ISSUE #20
+		{
+			return combine(right, [](word_type left, word_type right) { return left ^ right; });
+		}
+
+		[[nodiscard]] friend auto operator&(bit_matrix left, const bit_matrix& right)
+			-> bit_matrix // @TODO: ISSUE #20
+		{
+			return left &= right;
+		}
+
+		[[nodiscard]] friend auto operator|(bit_matrix left, const bit_matrix& right)
+			-> bit_matrix // @TODO: ISSUE #20
+		{
+			return left |= right;
+		}
+
+		[[nodiscard]] friend auto operator^(bit_matrix left, const bit_matrix& right)
+			-> bit_matrix // @TODO: ISSUE #20
+		{
+			return left ^= right;
+		}
+
+		[[nodiscard]] friend auto operator~(bit_matrix obj) -> bit_matrix // @TODO: ISSUE #20
+		{
+			if (obj.words_per_row_ == 0)
+			{
+				return obj;
+			}
+
+			for (auto row = std::size_t{}; row < obj.rows_; ++row)
+			{
+				const auto words = obj.row_data(row);
+
+				std::transform(words, words + obj.words_per_row_, words, [](word_type word) { return ~word; });
+
+				words[obj.words_per_row_ - 1] &= obj.last_word_mask();
+			}
+
+			return obj;
+		}
+
+		[[nodiscard]] friend auto operator==(const bit_matrix& left, const bit_matrix& right) noexcept
+			-> bool // @TODO: ISSUE #20
+		{
+			return left.rows_ == right.rows_ && left.columns_ == right.columns_ && left.words_ == right.words_;
+		}
+	};
+} // namespace mpp
@@ -0,0 +1,237 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/detail/expr/expr_aliasing.hpp>
+#include <mpp/detail/expr/expr_base.hpp>
+#include <mpp/detail/types/constraints.hpp>
+#include <mpp/matrix/matrix_view.hpp>
+#include <mpp/utility/configuration.hpp>
+#include <mpp/utility/layout.hpp>
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace mpp
+{
+	/**
+	 * Owning dynamic matrix storing its elements column by column (Fortran, LAPACK and BLAS ordering), so buffers
+	 * coming from or going to column-major code are moved in and out without a transpose-copy, and every column is a
+	 * contiguous range
+	 *
+	 * Indices, iteration and expressions are in terms of rows and columns like for any other matrix. Algorithms take
+	 * the matrix through view(), a column-major matrix_view
+	 */
+	template<detail::arithmetic Value, typename Allocator = typename configuration<override>::allocator<Value>>
+	class column_major_matrix : public detail::expr_base<column_major_matrix<Value, Allocator>, Value, dynamic, dynamic>
+	{
+		std::vector<Value, Allocator> buffer_;
+		std::size_t rows_{};
+		std::size_t columns_{};
+
+	public:
+		using value_type      = Value;
+		using allocator_type  = Allocator;
+		using size_type       = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer         = Value*;
+		using const_pointer   = const Value*;
+		using reference       = Value&;
+		using const_reference = const Value&;
+		using iterator        = typename matrix_view<Value, dynamic, dynamic, column_major>::iterator;
+		using const_iterator  = typename matrix_view<const Value, dynamic, dynamic, column_major>::iterator;
+
+		column_major_matrix() = default;
+
+		explicit column_major_matrix(const Allocator& allocator) noexcept : buffer_(allocator) {} // @TODO: ISSUE #20
+
+		column_major_matrix(std::size_t rows,
+			std::size_t columns,
+			const Value& value         = Value{},
+			const Allocator& allocator = Allocator{}) :
+			buffer_(rows * columns, value, allocator),
+			rows_(rows),
+			columns_(columns) // @TODO: ISSUE #20
+		{
+		}
+
+		/**
+		 * Adopts elements already stored column by column, without copying them
+		 */
+		column_major_matrix(std::size_t rows, std::size_t columns, std::vector<Value, Allocator>&& elements) :
+			buffer_(std::move(elements)),
+			rows_(rows),
+			columns_(columns) // @TODO: ISSUE #20
+		{
+			assert(buffer_.size() == rows * columns);
+		}
+
+		template<typename Expr,
+			std::convertible_to<Value> ExprValue,
+			std::size_t ExprRowsExtent,
+			std::size_t ExprColumnsExtent>
+		explicit column_major_matrix(
+			const detail::expr_base<Expr, ExprValue, ExprRowsExtent, ExprColumnsExtent>& expr,
+			const Allocator& allocator = Allocator{}) :
+			column_major_matrix(expr.rows(), expr.columns(), Value{}, allocator) // @TODO: ISSUE #20
+		{
+			view() = expr;
+		}
+
+		template<typename Expr,
+			std::convertible_to<Value> ExprValue,
+			std::size_t ExprRowsExtent,
+			std::size_t ExprColumnsExtent>
+		auto operator=(const detail::expr_base<Expr, ExprValue, ExprRowsExtent, ExprColumnsExtent>& expr)
+			-> column_major_matrix& // @TODO: ISSUE #20
+		{
+			const auto first = buffer_.data();
+
+			if (expr.rows() == rows_ && expr.columns() == columns_ &&
+				!detail::expr_reads_memory(expr, first, first + buffer_.size(), true))
+			{
+				view() = expr;
+			}
+			else
+			{
+				// Evaluated into a new buffer first because the expression can read elements of this matrix before
+				// they're overwritten (e.g. m = m * m)
+				*this = column_major_matrix(expr, buffer_.get_allocator());
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Hook for detail::expr_reads_memory
+		 */
+		[[nodiscard]] auto reads_memory(const void* first, const void* last, bool same_index_allowed) const noexcept
+			-> bool // @TODO: ISSUE #20
+		{
+			const auto data = buffer_.data();
+
+			return !same_index_allowed && detail::memory_overlaps(data, data + buffer_.size(), first, last);
+		}
+
+		[[nodiscard]] auto get_allocator() const noexcept -> Allocator // @TODO: ISSUE #20
+		{
+			return buffer_.get_allocator();
+		}
+
+		[[nodiscard]] auto rows() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return rows_;
+		}
+
+		[[nodiscard]] auto columns() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return columns_;
+		}
+
+		[[nodiscard]] auto size() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return rows_ * columns_;
+		}
+
+		[[nodiscard]] auto data() noexcept -> pointer // @TODO: ISSUE #20
+		{
+			return buffer_.data();
+		}
+
+		[[nodiscard]] auto data() const noexcept -> const_pointer // @TODO: ISSUE #20
+		{
+			return buffer_.data();
+		}
+
+		/**
+		 * First of the rows() adjacent elements of a column
+		 */
+		[[nodiscard]] auto column_data(std::size_t col_index) noexcept -> pointer // @TODO: ISSUE #20
+		{
+			return buffer_.data() + column_major::index(rows_, 0, col_index);
+		}
+
+		[[nodiscard]] auto column_data(std::size_t col_index) const noexcept -> const_pointer // @TODO: ISSUE #20
+		{
+			return buffer_.data() + column_major::index(rows_, 0, col_index);
+		}
+
+		[[nodiscard]] auto view() noexcept -> matrix_view<Value, dynamic, dynamic, column_major> // @TODO: ISSUE #20
+		{
+			return { buffer_.data(), rows_, columns_ };
+		}
+
+		[[nodiscard]] auto view() const noexcept
+			-> matrix_view<const Value, dynamic, dynamic, column_major> // @TODO: ISSUE #20
+		{
+			return { buffer_.data(), rows_, columns_ };
+		}
+
+		/**
+		 * Gives the column-major elements away without copying them, leaving the matrix empty
+		 */
+		[[nodiscard]] auto release() noexcept -> std::vector<Value, Allocator> // @TODO: ISSUE #20
+		{
+			auto buffer = std::move(buffer_);
+
+			buffer_.clear();
+			rows_    = 0;
+			columns_ = 0;
+
+			return buffer;
+		}
+
+		[[nodiscard]] auto begin() noexcept -> iterator // @TODO: ISSUE #20
+		{
+			return view().begin();
+		}
+
+		[[nodiscard]] auto begin() const noexcept -> const_iterator // @TODO: ISSUE #20
+		{
+			return view().begin();
+		}
+
+		[[nodiscard]] auto end() noexcept -> iterator // @TODO: ISSUE #20
+		{
+			return view().end();
+		}
+
+		[[nodiscard]] auto end() const noexcept -> const_iterator // @TODO: ISSUE #20
+		{
+			return view().end();
+		}
+
+		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) noexcept
+			-> reference // @TODO: ISSUE #20
+		{
+			return buffer_[column_major::index(rows_, row_index, col_index)];
+		}
+
+		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) const noexcept
+			-> const_reference // @TODO: ISSUE #20
+		{
+			return buffer_[column_major::index(rows_, row_index, col_index)];
+		}
+	};
+} // namespace mpp
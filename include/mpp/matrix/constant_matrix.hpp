@@ -0,0 +1,93 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/detail/expr/expr_base.hpp>
+#include <mpp/detail/types/constraints.hpp>
+#include <mpp/detail/utility/public.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+namespace mpp
+{
+	/**
+	 * Matrix with the same value in every element, which is only stored once. Sums and element-wise operations with
+	 * it don't need a filled matrix to be allocated first
+	 */
+	template<detail::arithmetic Value>
+	class constant_matrix : public detail::expr_base<constant_matrix<Value>, Value, dynamic, dynamic>
+	{
+		std::size_t rows_{};
+		std::size_t columns_{};
+		Value value_{};
+
+	public:
+		using value_type = Value;
+		using size_type  = std::size_t;
+
+		constant_matrix() = default;
+
+		constant_matrix(std::size_t rows, std::size_t columns, const Value& value) :
+			rows_(rows),
+			columns_(columns),
+			value_(value) // @TODO: ISSUE #20
+		{
+		}
+
+		[[nodiscard]] auto rows() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return rows_;
+		}
+
+		[[nodiscard]] auto columns() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return columns_;
+		}
+
+		[[nodiscard]] auto value() const noexcept -> const Value& // @TODO: ISSUE #20
+		{
+			return value_;
+		}
+
+		[[nodiscard]] auto operator()([[maybe_unused]] std::size_t row_index,
+			[[maybe_unused]] std::size_t col_index) const noexcept -> Value // @TODO: ISSUE #20
+		{
+			assert(row_index < rows_ && col_index < columns_);
+
+			return value_;
+		}
+	};
+
+	namespace detail
+	{
+		template<typename>
+		struct is_constant_matrix : std::false_type
+		{
+		};
+
+		template<typename Value>
+		struct is_constant_matrix<constant_matrix<Value>> : std::true_type
+		{
+		};
+	} // namespace detail
+} // namespace mpp
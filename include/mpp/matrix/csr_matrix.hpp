@@ -0,0 +1,273 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/detail/expr/expr_base.hpp>
+#include <mpp/detail/types/constraints.hpp>
+#include <mpp/detail/utility/public.hpp>
+#include <mpp/utility/configuration.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace mpp
+{
+	/**
+	 * Non-zero element of a sparse matrix given by its coordinates
+	 */
+	template<typename Value>
+	struct triplet
+	{
+		std::size_t row;
+		std::size_t column;
+		Value value;
+	};
+
+	/**
+	 * Sparse matrix in compressed sparse row (CSR) format: the non-zero elements are stored row after row with their
+	 * column indices, and row_offsets()[row] is where the elements of a row start (row_offsets()[rows()] is the number
+	 * of non-zero elements). Within a row, elements are sorted by their column index
+	 *
+	 * Element access does a binary search in the row, so it can be used in expressions and converted to a dense matrix
+	 * (e.g. mpp::matrix<double>{ sparse }), but products should go through mpp::product, which only touches the
+	 * non-zero elements
+	 */
+	template<detail::arithmetic Value, typename Allocator = typename configuration<override>::allocator<Value>>
+	class csr_matrix : public detail::expr_base<csr_matrix<Value, Allocator>, Value, dynamic, dynamic>
+	{
+		using index_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::size_t>;
+
+		std::vector<std::size_t, index_allocator> row_offsets_;
+		std::vector<std::size_t, index_allocator> column_indices_;
+		std::vector<Value, Allocator> values_;
+		std::size_t rows_{};
+		std::size_t columns_{};
+
+		template<typename Range>
+		void assign_from_triplets(Range&& triplets)
+		{
+			// Counting sort of the elements by their row
+			for (const triplet<Value>& element : triplets)
+			{
+				assert(element.row < rows_ && element.column < columns_);
+				++row_offsets_[element.row + 1];
+			}
+
+			std::partial_sum(row_offsets_.begin(), row_offsets_.end(), row_offsets_.begin());
+
+			const auto non_zeros = row_offsets_.back();
+			column_indices_.resize(non_zeros);
+			values_.resize(non_zeros);
+
+			auto next_positions = std::vector<std::size_t>(row_offsets_.begin(), row_offsets_.end() - 1);
+
+			for (const triplet<Value>& element : triplets)
+			{
+				const auto position       = next_positions[element.row]++;
+				column_indices_[position] = element.column;
+				values_[position]         = element.value;
+			}
+
+			// Sort every row by column, and sum duplicates while compacting the rows towards the front
+			auto row_elements = std::vector<std::pair<std::size_t, Value>>{};
+			auto row_begin    = std::size_t{};
+			auto compacted    = std::size_t{};
+
+			for (auto row = std::size_t{}; row < rows_; ++row)
+			{
+				const auto row_end = row_offsets_[row + 1];
+
+				row_elements.clear();
+
+				for (auto index = row_begin; index < row_end; ++index)
+				{
+					row_elements.emplace_back(column_indices_[index], values_[index]);
+				}
+
+				std::ranges::stable_sort(row_elements, {}, &std::pair<std::size_t, Value>::first);
+
+				row_offsets_[row] = compacted;
+
+				for (const auto& [column, value] : row_elements)
+				{
+					if (compacted > row_offsets_[row] && column_indices_[compacted - 1] == column)
+					{
+						values_[compacted - 1] += value;
+					}
+					else
+					{
+						column_indices_[compacted] = column;
+						values_[compacted]         = value;
+						++compacted;
+					}
+				}
+
+				row_begin = row_end;
+			}
+
+			row_offsets_[rows_] = compacted;
+			column_indices_.resize(compacted);
+			values_.resize(compacted);
+		}
+
+	public:
+		using value_type      = Value;
+		using allocator_type  = Allocator;
+		using size_type       = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+		csr_matrix() : csr_matrix(0, 0) {} // @TODO: ISSUE #20
+
+		/**
+		 * Matrix of the given size without any non-zero elements
+		 */
+		csr_matrix(std::size_t rows, std::size_t columns, const Allocator& allocator = Allocator{}) :
+			row_offsets_(rows + 1, std::size_t{}, index_allocator(allocator)),
+			column_indices_(index_allocator(allocator)),
+			values_(allocator),
+			rows_(rows),
+			columns_(columns) // @TODO: ISSUE #20
+		{
+		}
+
+		/**
+		 * Matrix built from (row, column, value) triplets in any order. Triplets with the same coordinates are summed
+		 */
+		template<std::ranges::forward_range Range>
+		requires(std::convertible_to<std::ranges::range_value_t<Range>, triplet<Value>>) csr_matrix(std::size_t rows,
+			std::size_t columns,
+			Range&& triplets,
+			const Allocator& allocator = Allocator{}) :
+			csr_matrix(rows, columns, allocator) // @TODO: ISSUE #20
+		{
+			assign_from_triplets(std::forward<Range>(triplets));
+		}
+
+		csr_matrix(std::size_t rows,
+			std::size_t columns,
+			std::initializer_list<triplet<Value>> triplets,
+			const Allocator& allocator = Allocator{}) :
+			csr_matrix(rows, columns, allocator) // @TODO: ISSUE #20
+		{
+			assign_from_triplets(triplets);
+		}
+
+		/**
+		 * Compresses a dense matrix (or an expression object), keeping the elements that aren't equal to zero
+		 */
+		template<typename Expr,
+			std::convertible_to<Value> ExprValue,
+			std::size_t ExprRowsExtent,
+			std::size_t ExprColumnsExtent>
+		explicit csr_matrix(const detail::expr_base<Expr, ExprValue, ExprRowsExtent, ExprColumnsExtent>& expr,
+			const Allocator& allocator = Allocator{}) :
+			csr_matrix(expr.rows(), expr.columns(), allocator) // @TODO: ISSUE #20
+		{
+			for (auto row = std::size_t{}; row < rows_; ++row)
+			{
+				for (auto column = std::size_t{}; column < columns_; ++column)
+				{
+					const auto value = static_cast<Value>(expr(row, column));
+
+					if (value != Value{})
+					{
+						column_indices_.push_back(column);
+						values_.push_back(value);
+					}
+				}
+
+				row_offsets_[row + 1] = values_.size();
+			}
+		}
+
+		[[nodiscard]] auto rows() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return rows_;
+		}
+
+		[[nodiscard]] auto columns() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return columns_;
+		}
+
+		/**
+		 * Number of stored elements
+		 */
+		[[nodiscard]] auto non_zeros() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return values_.size();
+		}
+
+		[[nodiscard]] auto row_offsets() const noexcept -> std::span<const std::size_t> // @TODO: ISSUE #20
+		{
+			return row_offsets_;
+		}
+
+		[[nodiscard]] auto column_indices() const noexcept -> std::span<const std::size_t> // @TODO: ISSUE #20
+		{
+			return column_indices_;
+		}
+
+		/**
+		 * Stored elements, which can be updated in place (the sparsity pattern can't)
+		 */
+		[[nodiscard]] auto values() noexcept -> std::span<Value> // @TODO: ISSUE #20
+		{
+			return values_;
+		}
+
+		[[nodiscard]] auto values() const noexcept -> std::span<const Value> // @TODO: ISSUE #20
+		{
+			return values_;
+		}
+
+		[[nodiscard]] auto get_allocator() const noexcept -> Allocator // @TODO: ISSUE #20
+		{
+			return values_.get_allocator();
+		}
+
+		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) const noexcept
+			-> Value // @TODO: ISSUE #20
+		{
+			assert(row_index < rows_ && col_index < columns_);
+
+			const auto row_begin = column_indices_.begin() + static_cast<difference_type>(row_offsets_[row_index]);
+			const auto row_end   = column_indices_.begin() + static_cast<difference_type>(row_offsets_[row_index + 1]);
+			const auto found     = std::lower_bound(row_begin, row_end, col_index);
+
+			if (found == row_end || *found != col_index)
+			{
+				return Value{};
+			}
+
+			return values_[static_cast<std::size_t>(found - column_indices_.begin())];
+		}
+	};
+} // namespace mpp
@@ -0,0 +1,194 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/detail/expr/expr_base.hpp>
+#include <mpp/detail/types/constraints.hpp>
+#include <mpp/detail/utility/public.hpp>
+#include <mpp/utility/configuration.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+namespace mpp
+{
+	/**
+	 * Square matrix whose only non-zero elements are on the main diagonal, which is the only thing stored. Products
+	 * with it are detected by the product expressions, which then scale the rows (diagonal on the left) or the
+	 * columns (diagonal on the right) of the other operand instead of computing dot products, so evaluating them
+	 * takes O(n^2) instead of O(n^3)
+	 */
+	template<detail::arithmetic Value, typename Allocator = typename configuration<override>::allocator<Value>>
+	class diagonal_matrix : public detail::expr_base<diagonal_matrix<Value, Allocator>, Value, dynamic, dynamic>
+	{
+		std::vector<Value, Allocator> diagonal_;
+
+	public:
+		using value_type      = Value;
+		using allocator_type  = Allocator;
+		using size_type       = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference       = Value&;
+		using const_reference = const Value&;
+
+		diagonal_matrix() = default;
+
+		explicit diagonal_matrix(std::size_t size,
+			const Value& value         = Value{},
+			const Allocator& allocator = Allocator{}) :
+			diagonal_(size, value, allocator) // @TODO: ISSUE #20
+		{
+		}
+
+		/**
+		 * Matrix with the elements of the range on its diagonal
+		 */
+		template<std::ranges::input_range Range>
+		requires(detail::range_1d_with_value_type_convertible_to<Range, Value>) explicit diagonal_matrix(
+			Range&& range,
+			const Allocator& allocator = Allocator{}) :
+			diagonal_(allocator) // @TODO: ISSUE #20
+		{
+			for (auto&& value : range)
+			{
+				diagonal_.push_back(static_cast<Value>(value));
+			}
+		}
+
+		diagonal_matrix(std::initializer_list<Value> diagonal, const Allocator& allocator = Allocator{}) :
+			diagonal_(diagonal, allocator) // @TODO: ISSUE #20
+		{
+		}
+
+		[[nodiscard]] auto rows() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return diagonal_.size();
+		}
+
+		[[nodiscard]] auto columns() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return diagonal_.size();
+		}
+
+		[[nodiscard]] auto diagonal(std::size_t index) noexcept -> reference // @TODO: ISSUE #20
+		{
+			assert(index < diagonal_.size());
+
+			return diagonal_[index];
+		}
+
+		[[nodiscard]] auto diagonal(std::size_t index) const noexcept -> const_reference // @TODO: ISSUE #20
+		{
+			assert(index < diagonal_.size());
+
+			return diagonal_[index];
+		}
+
+		[[nodiscard]] auto data() noexcept -> Value* // @TODO: ISSUE #20
+		{
+			return diagonal_.data();
+		}
+
+		[[nodiscard]] auto data() const noexcept -> const Value* // @TODO: ISSUE #20
+		{
+			return diagonal_.data();
+		}
+
+		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) const noexcept
+			-> Value // @TODO: ISSUE #20
+		{
+			assert(row_index < rows() && col_index < columns());
+
+			return row_index == col_index ? diagonal_[row_index] : Value{};
+		}
+	};
+
+	template<std::ranges::input_range Range>
+	diagonal_matrix(Range&&) -> diagonal_matrix<std::ranges::range_value_t<Range>>;
+
+	/**
+	 * Identity matrix that only stores its size, so it doesn't allocate anything unlike the identity constructors of
+	 * mpp::matrix. Products with it just return the elements of the other operand
+	 */
+	template<detail::arithmetic Value>
+	class identity_matrix : public detail::expr_base<identity_matrix<Value>, Value, dynamic, dynamic>
+	{
+		std::size_t size_{};
+
+	public:
+		using value_type = Value;
+		using size_type  = std::size_t;
+
+		identity_matrix() = default;
+
+		explicit identity_matrix(std::size_t size) noexcept : size_(size) {} // @TODO: ISSUE #20
+
+		[[nodiscard]] auto rows() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return size_;
+		}
+
+		[[nodiscard]] auto columns() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return size_;
+		}
+
+		[[nodiscard]] auto diagonal([[maybe_unused]] std::size_t index) const noexcept -> Value // @TODO: ISSUE #20
+		{
+			assert(index < size_);
+
+			return Value{ 1 };
+		}
+
+		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) const noexcept
+			-> Value // @TODO: ISSUE #20
+		{
+			assert(row_index < size_ && col_index < size_);
+
+			return row_index == col_index ? Value{ 1 } : Value{};
+		}
+	};
+
+	namespace detail
+	{
+		template<typename T>
+		struct is_diagonal_expr : std::false_type
+		{
+		};
+
+		template<typename Value, typename Allocator>
+		struct is_diagonal_expr<diagonal_matrix<Value, Allocator>> : std::true_type
+		{
+		};
+
+		template<typename Value>
+		struct is_diagonal_expr<identity_matrix<Value>> : std::true_type
+		{
+		};
+
+		template<typename T>
+		concept diagonal_expression = is_diagonal_expr<std::remove_cvref_t<T>>::value;
+	} // namespace detail
+} // namespace mpp
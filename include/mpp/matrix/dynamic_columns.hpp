@@ -24,6 +24,8 @@
 #include <mpp/detail/types/constraints.hpp>
 #include <mpp/detail/utility/utility.hpp>
 
+#include <cassert>
+#include <concepts>
 #include <initializer_list>
 #include <stdexcept>
 #include <type_traits>
@@ -58,6 +60,7 @@ namespace mpp
 		matrix(const matrix& right, const Allocator& allocator) :
 			base(right.rows_, right.columns_, right.buffer_, allocator) // @TODO: ISSUE #20
 		{
+			base::row_stride_ = right.row_stride_;
 		}
 
 		matrix(matrix&& right, const Allocator& allocator) :
@@ -66,6 +69,7 @@ namespace mpp
 				std::move(right.buffer_),
 				allocator) // @TODO: ISSUE #20
 		{
+			base::row_stride_ = right.row_stride_;
 		}
 
 		// clang-format off
@@ -112,12 +116,15 @@ namespace mpp
 			base::assign_and_insert_from_2d_range(std::forward<Range2D>(range_2d));
 		}
 
-		template<typename Expr, std::size_t ExprRowsExtent, std::size_t ExprColumnsExtent>
-		explicit matrix(const detail::expr_base<Expr, Value, ExprRowsExtent, ExprColumnsExtent>& expr,
+		template<typename Expr,
+			std::convertible_to<Value> ExprValue,
+			std::size_t ExprRowsExtent,
+			std::size_t ExprColumnsExtent>
+		explicit matrix(const detail::expr_base<Expr, ExprValue, ExprRowsExtent, ExprColumnsExtent>& expr,
 			const Allocator& allocator = Allocator{}) :
 			base(RowsExtent, 0, allocator) // @TODO: ISSUE #20
 		{
-			base::initialize_from_expression_unchecked(RowsExtent, expr.columns(), expr);
+			base::assign_from_expression_unchecked(RowsExtent, expr.columns(), expr);
 		}
 
 		matrix(std::size_t columns, const Value& value, const Allocator& allocator = Allocator{}) :
@@ -135,6 +142,21 @@ namespace mpp
 			detail::make_identity_buffer(base::buffer_, RowsExtent, columns, zero_value, one_value);
 		}
 
+		matrix(std::size_t columns, uninitialized_tag, const Allocator& allocator = Allocator{}) :
+			base(RowsExtent, columns, allocator) // @TODO: ISSUE #20
+		{
+			detail::allocate_uninitialized_buffer_if_vector(base::buffer_, RowsExtent, columns);
+		}
+
+		/**
+		 * Takes over the elements of a buffer holding RowsExtent * columns elements (row-major), without copying them
+		 */
+		matrix(std::size_t columns, adopt_tag, typename base::buffer_type&& buffer) noexcept :
+			base(RowsExtent, columns, std::move(buffer)) // @TODO: ISSUE #20
+		{
+			assert(base::buffer_.size() == RowsExtent * columns);
+		}
+
 		// @FIXME: Allow callable's value return be convertible to value type
 		template<detail::invocable_with_return_type<Value> Callable>
 		matrix(std::size_t columns, Callable&& callable, const Allocator& allocator = Allocator{}) :
@@ -24,6 +24,8 @@
 #include <mpp/detail/types/constraints.hpp>
 #include <mpp/detail/utility/utility.hpp>
 
+#include <cassert>
+#include <concepts>
 #include <initializer_list>
 #include <stdexcept>
 #include <type_traits>
@@ -57,6 +59,7 @@ namespace mpp
 		matrix(const matrix& right, const Allocator& allocator) :
 			base(right.rows_, right.columns_, right.buffer_, allocator) // @TODO: ISSUE #20
 		{
+			base::row_stride_ = right.row_stride_;
 		}
 
 		matrix(matrix&& right, const Allocator& allocator) :
@@ -65,6 +68,7 @@ namespace mpp
 				std::move(right.buffer_),
 				allocator) // @TODO: ISSUE #20
 		{
+			base::row_stride_ = right.row_stride_;
 		}
 
 		// clang-format off
@@ -107,12 +111,15 @@ namespace mpp
 			base::assign_and_insert_from_2d_range(std::forward<Range2D>(range_2d));
 		}
 
-		template<typename Expr, std::size_t ExprRowsExtent, std::size_t ExprColumnsExtent>
-		explicit matrix(const detail::expr_base<Expr, Value, ExprRowsExtent, ExprColumnsExtent>& expr,
+		template<typename Expr,
+			std::convertible_to<Value> ExprValue,
+			std::size_t ExprRowsExtent,
+			std::size_t ExprColumnsExtent>
+		explicit matrix(const detail::expr_base<Expr, ExprValue, ExprRowsExtent, ExprColumnsExtent>& expr,
 			const Allocator allocator = Allocator{}) :
 			base(0, 0, allocator) // @TODO: ISSUE #20
 		{
-			base::initialize_from_expression_unchecked(expr.rows(), expr.columns(), expr);
+			base::assign_from_expression_unchecked(expr.rows(), expr.columns(), expr);
 		}
 
 		matrix(std::size_t rows, std::size_t columns, const Allocator& allocator = Allocator{}) :
@@ -136,6 +143,21 @@ namespace mpp
 			detail::make_identity_buffer(base::buffer_, rows, columns, zero_value, one_value);
 		}
 
+		matrix(std::size_t rows, std::size_t columns, uninitialized_tag, const Allocator& allocator = Allocator{}) :
+			base(rows, columns, allocator) // @TODO: ISSUE #20
+		{
+			detail::allocate_uninitialized_buffer_if_vector(base::buffer_, rows, columns);
+		}
+
+		/**
+		 * Takes over the elements of a buffer holding rows * columns elements (row-major), without copying them
+		 */
+		matrix(std::size_t rows, std::size_t columns, adopt_tag, typename base::buffer_type&& buffer) noexcept :
+			base(rows, columns, std::move(buffer)) // @TODO: ISSUE #20
+		{
+			assert(base::buffer_.size() == rows * columns);
+		}
+
 		// @FIXME: Allow callable's value return be convertible to value type
 		template<detail::invocable_with_return_type<Value> Callable>
 		matrix(std::size_t rows, std::size_t columns, Callable&& callable, const Allocator& allocator = Allocator{}) :
@@ -56,7 +56,7 @@ namespace mpp
 	public:
 		using base::operator=;
 
-		matrix() : base(RowsExtent, ColumnsExtent)
+		matrix() : base(uninitialized, RowsExtent, ColumnsExtent)
 		{
 			fill_buffer_with_value(Value{});
 		}
@@ -97,31 +97,28 @@ namespace mpp
 		explicit matrix(const std::array<std::array<Array2DValue, ColumnsExtent>, RowsExtent>& array_2d) :
 			base(RowsExtent, ColumnsExtent)
 		{
-			base::assign_and_insert_from_2d_range<false, false, false>(array_2d);
+			base::assign_and_insert_from_2d_range(array_2d);
 		}
 
 		template<std::convertible_to<Value> Array2DValue>
 		explicit matrix(std::array<std::array<Array2DValue, ColumnsExtent>, RowsExtent>&& array_2d) :
 			base(RowsExtent, ColumnsExtent)
 		{
-			base::assign_and_insert_from_2d_range<false, false, false>(std::move(array_2d));
+			base::assign_and_insert_from_2d_range(std::move(array_2d));
 		}
 
 
-		template<typename Expr, std::size_t ExprRowsExtent, std::size_t ExprColumnsExtent>
-		explicit matrix(const detail::expr_base<Expr, Value, ExprRowsExtent, ExprColumnsExtent>& expr) :
-			base(RowsExtent, ColumnsExtent) // @TODO: ISSUE #20
+		template<typename Expr,
+			std::convertible_to<Value> ExprValue,
+			std::size_t ExprRowsExtent,
+			std::size_t ExprColumnsExtent>
+		explicit matrix(const detail::expr_base<Expr, ExprValue, ExprRowsExtent, ExprColumnsExtent>& expr) :
+			base(uninitialized, RowsExtent, ColumnsExtent) // @TODO: ISSUE #20
 		{
-			for (auto row = std::size_t{}, index = std::size_t{}; row < RowsExtent; ++row)
-			{
-				for (auto column = std::size_t{}; column < ColumnsExtent; ++column)
-				{
-					base::buffer_[index++] = expr(row, column);
-				}
-			}
+			base::assign_from_expression_unchecked(RowsExtent, ColumnsExtent, expr);
 		}
 
-		explicit matrix(const Value& value) : base(RowsExtent, ColumnsExtent) // @TODO: ISSUE #20
+		explicit matrix(const Value& value) : base(uninitialized, RowsExtent, ColumnsExtent) // @TODO: ISSUE #20
 		{
 			fill_buffer_with_value(value);
 		}
@@ -132,9 +129,19 @@ namespace mpp
 			detail::make_identity_buffer(base::buffer_, RowsExtent, ColumnsExtent, zero_value, one_value);
 		}
 
+		explicit matrix(uninitialized_tag) noexcept :
+			base(uninitialized, RowsExtent, ColumnsExtent) // @TODO: ISSUE #20
+		{
+		}
+
+		matrix(adopt_tag, typename base::buffer_type&& buffer) noexcept :
+			base(RowsExtent, ColumnsExtent, std::move(buffer)) // @TODO: ISSUE #20
+		{
+		}
+
 		// @FIXME: Allow callable's value return be convertible to value type
 		template<detail::invocable_with_return_type<Value> Callable>
-		explicit matrix(Callable&& callable) : base(RowsExtent, ColumnsExtent) // @TODO: ISSUE #20
+		explicit matrix(Callable&& callable) : base(uninitialized, RowsExtent, ColumnsExtent) // @TODO: ISSUE #20
 		{
 			std::ranges::generate(base::buffer_, std::forward<Callable>(callable));
 		}
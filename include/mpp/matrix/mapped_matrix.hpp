@@ -0,0 +1,277 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/memory/mapped_file.hpp>
+
+#ifdef MPP_HAS_MAPPED_FILE
+	#include <mpp/detail/expr/expr_aliasing.hpp>
+	#include <mpp/detail/expr/expr_base.hpp>
+	#include <mpp/detail/types/constraints.hpp>
+	#include <mpp/detail/utility/buffer_manipulators.hpp>
+	#include <mpp/detail/utility/utility.hpp>
+	#include <mpp/matrix/matrix_view.hpp>
+
+	#include <algorithm>
+	#include <cassert>
+	#include <concepts>
+	#include <cstddef>
+	#include <filesystem>
+	#include <limits>
+	#include <stdexcept>
+	#include <type_traits>
+	#include <utility>
+	#include <vector>
+
+namespace mpp
+{
+	/**
+	 * Dynamic matrix whose elements live in a memory-mapped file (POSIX only), stored row-major as raw values, starting
+	 * at a byte offset to skip e.g. a header. Only the pages that are touched get loaded, so datasets bigger than the
+	 * memory can be opened and swept
+	 *
+	 * The file is mapped read-only when Value is const. Otherwise writes go back to the file through the page cache,
+	 * and flush() waits until they reach it. Algorithms take the elements through view()
+	 */
+	template<typename Value>
+	requires(detail::arithmetic<std::remove_const_t<Value>>) class mapped_matrix :
+		public detail::expr_base<mapped_matrix<Value>, std::remove_const_t<Value>, dynamic, dynamic>
+	{
+		mapped_file file_;
+		Value* data_ = nullptr;
+		std::size_t rows_{};
+		std::size_t columns_{};
+
+		/**
+		 * rows * columns, checked for overflow since the dimensions usually come from outside (e.g. a file header)
+		 */
+		[[nodiscard]] static auto element_count(std::size_t rows, std::size_t columns)
+			-> std::size_t // @TODO: ISSUE #20
+		{
+			if (rows != 0 && columns > (std::numeric_limits<std::size_t>::max)() / rows)
+			{
+				throw std::length_error("mpp::mapped_matrix: the dimensions overflow the number of elements");
+			}
+
+			return rows * columns;
+		}
+
+		mapped_matrix(mapped_file file, std::size_t rows, std::size_t columns, std::size_t offset) :
+			file_(std::move(file)),
+			rows_(rows),
+			columns_(columns) // @TODO: ISSUE #20
+		{
+			assert(offset % alignof(Value) == 0);
+
+			if (file_.size() < offset || (file_.size() - offset) / sizeof(Value) < element_count(rows, columns))
+			{
+				throw std::length_error("mpp::mapped_matrix: the file is too small for the requested dimensions");
+			}
+
+			if (file_.data() != nullptr)
+			{
+				data_ = reinterpret_cast<Value*>(file_.data() + offset);
+			}
+		}
+
+	public:
+		using value_type      = std::remove_const_t<Value>;
+		using size_type       = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer         = Value*;
+		using const_pointer   = const Value*;
+		using reference       = Value&;
+		using const_reference = const Value&;
+		using iterator        = typename matrix_view<Value>::iterator;
+		using const_iterator  = typename matrix_view<const Value>::iterator;
+
+		mapped_matrix() noexcept = default; // @TODO: ISSUE #20
+
+		/**
+		 * Maps an existing file holding at least rows * columns values after offset bytes
+		 */
+		mapped_matrix(const std::filesystem::path& path,
+			std::size_t rows,
+			std::size_t columns,
+			std::size_t offset = 0) :
+			mapped_matrix(
+				mapped_file(path, std::is_const_v<Value> ? mapped_file_mode::read_only : mapped_file_mode::read_write),
+				rows,
+				columns,
+				offset) // @TODO: ISSUE #20
+		{
+		}
+
+		/**
+		 * Creates (or truncates) a file holding rows * columns zeros and maps it
+		 */
+		[[nodiscard]] static auto create(const std::filesystem::path& path, std::size_t rows, std::size_t columns)
+			-> mapped_matrix requires(!std::is_const_v<Value>) // @TODO: ISSUE #20
+		{
+			const auto count = element_count(rows, columns);
+
+			if (count > (std::numeric_limits<std::size_t>::max)() / sizeof(Value))
+			{
+				throw std::length_error("mpp::mapped_matrix: the dimensions overflow the size of the file");
+			}
+
+			return mapped_matrix(mapped_file(path, mapped_file_mode::create, count * sizeof(Value)), rows, columns, 0);
+		}
+
+		mapped_matrix(mapped_matrix&& right) noexcept :
+			file_(std::move(right.file_)),
+			data_(std::exchange(right.data_, nullptr)),
+			rows_(std::exchange(right.rows_, 0)),
+			columns_(std::exchange(right.columns_, 0)) // @TODO: ISSUE #20
+		{
+		}
+
+		auto operator=(mapped_matrix&& right) noexcept -> mapped_matrix& // @TODO: ISSUE #20
+		{
+			if (this != &right)
+			{
+				file_    = std::move(right.file_);
+				data_    = std::exchange(right.data_, nullptr);
+				rows_    = std::exchange(right.rows_, 0);
+				columns_ = std::exchange(right.columns_, 0);
+			}
+
+			return *this;
+		}
+
+		template<typename Expr,
+			std::convertible_to<value_type> ExprValue,
+			std::size_t ExprRowsExtent,
+			std::size_t ExprColumnsExtent>
+		auto operator=(const detail::expr_base<Expr, ExprValue, ExprRowsExtent, ExprColumnsExtent>& expr)
+			-> mapped_matrix& requires(!std::is_const_v<Value>) // @TODO: ISSUE #20
+		{
+			// The file isn't resized behind the user's back
+			assert(expr.rows() == rows_ && expr.columns() == columns_);
+
+			if (!detail::expr_reads_memory(expr, data_, data_ + size(), true))
+			{
+				view() = expr;
+			}
+			else
+			{
+				// The expression reads elements of this matrix before they're overwritten (e.g. m = m * m), so it's
+				// evaluated into memory first and copied into the file afterwards
+				auto buffer = std::vector<value_type>{};
+
+				detail::eval_expr_into_buffer(buffer, rows_, columns_, expr);
+				std::ranges::copy(buffer, data_);
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Hook for detail::expr_reads_memory
+		 */
+		[[nodiscard]] auto reads_memory(const void* first, const void* last, bool same_index_allowed) const noexcept
+			-> bool // @TODO: ISSUE #20
+		{
+			return !same_index_allowed && detail::memory_overlaps(data_, data_ + size(), first, last);
+		}
+
+		[[nodiscard]] auto rows() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return rows_;
+		}
+
+		[[nodiscard]] auto columns() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return columns_;
+		}
+
+		[[nodiscard]] auto size() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return rows_ * columns_;
+		}
+
+		[[nodiscard]] auto data() noexcept -> pointer // @TODO: ISSUE #20
+		{
+			return data_;
+		}
+
+		[[nodiscard]] auto data() const noexcept -> const_pointer // @TODO: ISSUE #20
+		{
+			return data_;
+		}
+
+		[[nodiscard]] auto view() noexcept -> matrix_view<Value> // @TODO: ISSUE #20
+		{
+			return { data_, rows_, columns_ };
+		}
+
+		[[nodiscard]] auto view() const noexcept -> matrix_view<const Value> // @TODO: ISSUE #20
+		{
+			return { data_, rows_, columns_ };
+		}
+
+		[[nodiscard]] auto begin() noexcept -> iterator // @TODO: ISSUE #20
+		{
+			return view().begin();
+		}
+
+		[[nodiscard]] auto begin() const noexcept -> const_iterator // @TODO: ISSUE #20
+		{
+			return view().begin();
+		}
+
+		[[nodiscard]] auto end() noexcept -> iterator // @TODO: ISSUE #20
+		{
+			return view().end();
+		}
+
+		[[nodiscard]] auto end() const noexcept -> const_iterator // @TODO: ISSUE #20
+		{
+			return view().end();
+		}
+
+		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) noexcept
+			-> reference // @TODO: ISSUE #20
+		{
+			return data_[detail::index_2d_to_1d(columns_, row_index, col_index)];
+		}
+
+		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) const noexcept
+			-> const_reference // @TODO: ISSUE #20
+		{
+			return data_[detail::index_2d_to_1d(columns_, row_index, col_index)];
+		}
+
+		/**
+		 * Hints that the elements are going to be swept once in order
+		 */
+		void advise_sequential() const noexcept // @TODO: ISSUE #20
+		{
+			file_.advise_sequential();
+		}
+
+		void flush() const // @TODO: ISSUE #20
+		{
+			file_.flush();
+		}
+	};
+} // namespace mpp
+#endif
@@ -0,0 +1,282 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/detail/expr/expr_aliasing.hpp>
+#include <mpp/detail/expr/expr_base.hpp>
+#include <mpp/detail/matrix/matrix_view_iterator.hpp>
+#include <mpp/detail/types/constraints.hpp>
+#include <mpp/detail/utility/buffer_manipulators.hpp>
+#include <mpp/detail/utility/extent_storage.hpp>
+#include <mpp/detail/utility/utility.hpp>
+#include <mpp/utility/configuration.hpp>
+#include <mpp/utility/layout.hpp>
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace mpp
+{
+	/**
+	 * Non-owning view of elements living somewhere else, e.g. a network buffer, shared memory or the buffer of a
+	 * matrix. Elements are stored row-major by default, or column-major (e.g. data coming from Fortran) with the
+	 * column_major layout. Rows (or columns) can be further apart than their length (stride), so views can also refer
+	 * to part of a bigger array. The view never copies nor frees the elements, so the memory has to outlive it
+	 *
+	 * Indices, iteration and expressions are always in terms of rows and columns whatever the layout is
+	 *
+	 * Like std::span, constness is shallow: use a const Value to make the elements read-only
+	 */
+	template<typename Value,
+		std::size_t RowsExtent    = dynamic,
+		std::size_t ColumnsExtent = dynamic,
+		typename Layout           = row_major>
+	requires(detail::arithmetic<std::remove_const_t<Value>>) class matrix_view :
+		public detail::expr_base<matrix_view<Value, RowsExtent, ColumnsExtent, Layout>,
+			std::remove_const_t<Value>,
+			RowsExtent,
+			ColumnsExtent>
+	{
+		Value* data_;
+		[[no_unique_address]] detail::rows_storage<RowsExtent> rows_;
+		[[no_unique_address]] detail::columns_storage<ColumnsExtent> columns_;
+		std::size_t stride_;
+
+		void assign_from_expression(const auto& expr) const // @TODO: ISSUE #20
+		{
+			assert(rows_ == expr.rows() && columns_ == expr.columns());
+
+			if (detail::expr_reads_memory(expr, data_, memory_end(), true))
+			{
+				// The expression reads elements of this view before they're overwritten (e.g. v = transposed(v)), so
+				// it's evaluated into memory first
+				using expr_value_type = typename std::remove_cvref_t<decltype(expr)>::value_type;
+
+				auto buffer = std::vector<expr_value_type>{};
+				detail::eval_expr_into_buffer(buffer, rows_, columns_, expr);
+
+				write_elements(matrix_view<const expr_value_type>{ buffer.data(), rows_, columns_ });
+			}
+			else
+			{
+				write_elements(expr);
+			}
+		}
+
+		void write_elements(const auto& expr) const // @TODO: ISSUE #20
+		{
+			for (auto row = std::size_t{}; row < rows_; ++row)
+			{
+				for (auto column = std::size_t{}; column < columns_; ++column)
+				{
+					data_[Layout::index(stride_, row, column)] = static_cast<value_type>(expr(row, column));
+				}
+			}
+		}
+
+	public:
+		using element_type    = Value;
+		using value_type      = std::remove_const_t<Value>;
+		using size_type       = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer         = Value*;
+		using const_pointer   = const Value*;
+		using reference       = Value&;
+		using const_reference = const Value&;
+		using layout_type     = Layout;
+		using iterator        = detail::matrix_view_iterator<Value, Layout>;
+		using const_iterator  = detail::matrix_view_iterator<const Value, Layout>;
+
+		// Allocator of the matrices algorithms create out of a view
+		using allocator_type = typename configuration<override>::allocator<value_type>;
+
+		matrix_view(pointer data, std::size_t rows, std::size_t columns, std::size_t stride) noexcept :
+			data_(data),
+			rows_(rows),
+			columns_(columns),
+			stride_(stride) // @TODO: ISSUE #20
+		{
+			assert(RowsExtent == dynamic || RowsExtent == rows);
+			assert(ColumnsExtent == dynamic || ColumnsExtent == columns);
+			assert(stride >= Layout::min_stride(rows, columns));
+		}
+
+		matrix_view(pointer data, std::size_t rows, std::size_t columns) noexcept :
+			matrix_view(data, rows, columns, Layout::min_stride(rows, columns)) // @TODO: ISSUE #20
+		{
+		}
+
+		explicit matrix_view(pointer data) noexcept requires(RowsExtent != dynamic && ColumnsExtent != dynamic) :
+			matrix_view(data, RowsExtent, ColumnsExtent) // @TODO: ISSUE #20
+		{
+		}
+
+		matrix_view(const matrix_view&) noexcept = default; // @TODO: ISSUE #20
+
+		/**
+		 * Assigning to a view writes into the elements it refers to instead of rebinding it, so blocks of a bigger
+		 * matrix can be updated in place. Elements are written while the right side is read, so an expression reading
+		 * other elements of the same memory (e.g. the transpose of the view itself) has to be evaluated first
+		 */
+		auto operator=(const matrix_view& right) -> matrix_view& requires(!std::is_const_v<Value>) // @TODO: ISSUE #20
+		{
+			if (right.data_ == data_ && right.stride_ == stride_)
+			{
+				// Same elements at the same positions
+				return *this;
+			}
+
+			assign_from_expression(right);
+			return *this;
+		}
+
+		template<typename Expr,
+			std::convertible_to<value_type> ExprValue,
+			std::size_t ExprRowsExtent,
+			std::size_t ExprColumnsExtent>
+		requires(!std::is_const_v<Value>) auto operator=(
+			const detail::expr_base<Expr, ExprValue, ExprRowsExtent, ExprColumnsExtent>& expr)
+			-> matrix_view& // @TODO: ISSUE #20
+		{
+			assign_from_expression(expr);
+			return *this;
+		}
+
+		// clang-format off
+		template<typename Matrix>
+			requires(std::same_as<Layout, row_major> && detail::is_matrix<std::remove_const_t<Matrix>>::value &&
+				std::is_convertible_v<decltype(std::declval<Matrix&>().data()), pointer>)
+		matrix_view(Matrix& obj) noexcept :
+			matrix_view(obj.data(), obj.rows(), obj.columns()) // @TODO: ISSUE #20
+		{
+		}
+		// clang-format on
+
+		[[nodiscard]] auto rows() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return rows_;
+		}
+
+		[[nodiscard]] auto columns() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return columns_;
+		}
+
+		/**
+		 * Distance between the first elements of two consecutive rows (or columns with the column-major layout)
+		 */
+		[[nodiscard]] auto stride() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return stride_;
+		}
+
+		[[nodiscard]] auto size() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return rows_ * columns_;
+		}
+
+		[[nodiscard]] auto empty() const noexcept -> bool // @TODO: ISSUE #20
+		{
+			return size() == 0;
+		}
+
+		[[nodiscard]] auto is_contiguous() const noexcept -> bool // @TODO: ISSUE #20
+		{
+			return stride_ == Layout::min_stride(rows_, columns_) ||
+				(std::same_as<Layout, row_major> ? rows() : columns()) <= 1;
+		}
+
+		[[nodiscard]] auto data() const noexcept -> pointer // @TODO: ISSUE #20
+		{
+			return data_;
+		}
+
+		/**
+		 * One past the last element the view refers to, which with a stride isn't data() + size()
+		 */
+		[[nodiscard]] auto memory_end() const noexcept -> pointer // @TODO: ISSUE #20
+		{
+			return empty() ? data_ : data_ + Layout::index(stride_, rows_ - 1, columns_ - 1) + 1;
+		}
+
+		[[nodiscard]] auto begin() const noexcept -> iterator // @TODO: ISSUE #20
+		{
+			return iterator(data_, 0, columns_, stride_);
+		}
+
+		[[nodiscard]] auto end() const noexcept -> iterator // @TODO: ISSUE #20
+		{
+			return iterator(data_, static_cast<difference_type>(size()), columns_, stride_);
+		}
+
+		[[nodiscard]] auto cbegin() const noexcept -> const_iterator // @TODO: ISSUE #20
+		{
+			return const_iterator(data_, 0, columns_, stride_);
+		}
+
+		[[nodiscard]] auto cend() const noexcept -> const_iterator // @TODO: ISSUE #20
+		{
+			return const_iterator(data_, static_cast<difference_type>(size()), columns_, stride_);
+		}
+
+		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) const noexcept
+			-> reference // @TODO: ISSUE #20
+		{
+			assert(row_index < rows_ && col_index < columns_);
+
+			return data_[Layout::index(stride_, row_index, col_index)];
+		}
+	};
+
+	/**
+	 * Deduction guides
+	 */
+
+	template<typename Value>
+	matrix_view(Value*, std::size_t, std::size_t) -> matrix_view<Value>;
+
+	template<typename Value>
+	matrix_view(Value*, std::size_t, std::size_t, std::size_t) -> matrix_view<Value>;
+
+	template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Allocator>
+	matrix_view(matrix<Value, RowsExtent, ColumnsExtent, Allocator>&) -> matrix_view<Value, RowsExtent, ColumnsExtent>;
+
+	template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Allocator>
+	matrix_view(const matrix<Value, RowsExtent, ColumnsExtent, Allocator>&)
+		-> matrix_view<const Value, RowsExtent, ColumnsExtent>;
+
+	namespace detail
+	{
+		template<typename>
+		struct is_matrix_view : std::false_type
+		{
+		};
+
+		template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Layout>
+		struct is_matrix_view<matrix_view<Value, RowsExtent, ColumnsExtent, Layout>> : std::true_type
+		{
+		};
+	} // namespace detail
+} // namespace mpp
@@ -0,0 +1,251 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/detail/expr/expr_aliasing.hpp>
+#include <mpp/detail/expr/expr_base.hpp>
+#include <mpp/detail/types/constraints.hpp>
+#include <mpp/detail/utility/utility.hpp>
+#include <mpp/matrix/matrix_view.hpp>
+#include <mpp/memory/aligned_allocator.hpp>
+#include <mpp/utility/configuration.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace mpp
+{
+	/**
+	 * Leading dimension (distance between the first elements of two consecutive rows) for rows of the given length.
+	 * When a row spans a multiple of 4 KiB, walking down a column hits the same few cache sets over and over, so rows
+	 * get a cache line of padding to spread the columns across the sets
+	 */
+	template<typename Value>
+	[[nodiscard]] constexpr auto padded_leading_dimension(std::size_t columns) noexcept -> std::size_t
+	{
+		constexpr auto critical_stride = std::size_t{ 4096 };
+		constexpr auto padding         = std::max(cache_line_alignment / sizeof(Value), std::size_t{ 1 });
+
+		if (columns != 0 && (columns * sizeof(Value)) % critical_stride == 0)
+		{
+			return columns + padding;
+		}
+
+		return columns;
+	}
+
+	/**
+	 * Explicit leading dimension of a padded matrix
+	 */
+	struct row_stride
+	{
+		std::size_t value;
+	};
+
+	/**
+	 * Owning dynamic matrix whose rows can be padded, i.e. its leading dimension can be bigger than its column count.
+	 * The padding is chosen by padded_leading_dimension unless one is passed explicitly
+	 *
+	 * Elements are accessed, iterated and used in expressions like any other matrix, and the padding is never part of
+	 * them. Algorithms take the padded matrix through view(), which carries the leading dimension as its stride
+	 */
+	template<detail::arithmetic Value, typename Allocator = typename configuration<override>::allocator<Value>>
+	class padded_matrix : public detail::expr_base<padded_matrix<Value, Allocator>, Value, dynamic, dynamic>
+	{
+		std::vector<Value, Allocator> buffer_;
+		std::size_t rows_{};
+		std::size_t columns_{};
+		std::size_t leading_dimension_{};
+
+	public:
+		using value_type      = Value;
+		using allocator_type  = Allocator;
+		using size_type       = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer         = Value*;
+		using const_pointer   = const Value*;
+		using reference       = Value&;
+		using const_reference = const Value&;
+		using iterator        = typename matrix_view<Value>::iterator;
+		using const_iterator  = typename matrix_view<const Value>::iterator;
+
+		padded_matrix() = default;
+
+		explicit padded_matrix(const Allocator& allocator) noexcept : buffer_(allocator) {} // @TODO: ISSUE #20
+
+		padded_matrix(std::size_t rows,
+			std::size_t columns,
+			row_stride stride,
+			const Value& value         = Value{},
+			const Allocator& allocator = Allocator{}) :
+			buffer_(rows * stride.value, value, allocator),
+			rows_(rows),
+			columns_(columns),
+			leading_dimension_(stride.value) // @TODO: ISSUE #20
+		{
+			assert(stride.value >= columns);
+		}
+
+		padded_matrix(std::size_t rows,
+			std::size_t columns,
+			const Value& value         = Value{},
+			const Allocator& allocator = Allocator{}) :
+			padded_matrix(rows,
+				columns,
+				row_stride{ padded_leading_dimension<Value>(columns) },
+				value,
+				allocator) // @TODO: ISSUE #20
+		{
+		}
+
+		template<typename Expr,
+			std::convertible_to<Value> ExprValue,
+			std::size_t ExprRowsExtent,
+			std::size_t ExprColumnsExtent>
+		explicit padded_matrix(const detail::expr_base<Expr, ExprValue, ExprRowsExtent, ExprColumnsExtent>& expr,
+			const Allocator& allocator = Allocator{}) :
+			padded_matrix(expr.rows(), expr.columns(), Value{}, allocator) // @TODO: ISSUE #20
+		{
+			view() = expr;
+		}
+
+		template<typename Expr,
+			std::convertible_to<Value> ExprValue,
+			std::size_t ExprRowsExtent,
+			std::size_t ExprColumnsExtent>
+		auto operator=(const detail::expr_base<Expr, ExprValue, ExprRowsExtent, ExprColumnsExtent>& expr)
+			-> padded_matrix& // @TODO: ISSUE #20
+		{
+			const auto same_size = expr.rows() == rows_ && expr.columns() == columns_;
+			const auto first     = buffer_.data();
+
+			if (same_size && !detail::expr_reads_memory(expr, first, first + buffer_.size(), true))
+			{
+				view() = expr;
+			}
+			else
+			{
+				// Evaluated into a new buffer first because the expression can read elements of this matrix before
+				// they're overwritten (e.g. p = p * p). A matrix keeping its size keeps its leading dimension too
+				const auto leading_dimension =
+					same_size ? leading_dimension_ : padded_leading_dimension<Value>(expr.columns());
+
+				auto result = padded_matrix(expr.rows(),
+					expr.columns(),
+					row_stride{ leading_dimension },
+					Value{},
+					buffer_.get_allocator());
+
+				result.view() = expr;
+				*this         = std::move(result);
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Hook for detail::expr_reads_memory, the padding is never read so any overlap is with the elements
+		 */
+		[[nodiscard]] auto reads_memory(const void* first, const void* last, bool same_index_allowed) const noexcept
+			-> bool // @TODO: ISSUE #20
+		{
+			const auto data = buffer_.data();
+
+			return !same_index_allowed && detail::memory_overlaps(data, data + buffer_.size(), first, last);
+		}
+
+		[[nodiscard]] auto rows() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return rows_;
+		}
+
+		[[nodiscard]] auto columns() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return columns_;
+		}
+
+		[[nodiscard]] auto leading_dimension() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return leading_dimension_;
+		}
+
+		[[nodiscard]] auto size() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return rows_ * columns_;
+		}
+
+		[[nodiscard]] auto data() noexcept -> pointer // @TODO: ISSUE #20
+		{
+			return buffer_.data();
+		}
+
+		[[nodiscard]] auto data() const noexcept -> const_pointer // @TODO: ISSUE #20
+		{
+			return buffer_.data();
+		}
+
+		[[nodiscard]] auto view() noexcept -> matrix_view<Value> // @TODO: ISSUE #20
+		{
+			return { buffer_.data(), rows_, columns_, leading_dimension_ };
+		}
+
+		[[nodiscard]] auto view() const noexcept -> matrix_view<const Value> // @TODO: ISSUE #20
+		{
+			return { buffer_.data(), rows_, columns_, leading_dimension_ };
+		}
+
+		[[nodiscard]] auto begin() noexcept -> iterator // @TODO: ISSUE #20
+		{
+			return view().begin();
+		}
+
+		[[nodiscard]] auto begin() const noexcept -> const_iterator // @TODO: ISSUE #20
+		{
+			return view().begin();
+		}
+
+		[[nodiscard]] auto end() noexcept -> iterator // @TODO: ISSUE #20
+		{
+			return view().end();
+		}
+
+		[[nodiscard]] auto end() const noexcept -> const_iterator // @TODO: ISSUE #20
+		{
+			return view().end();
+		}
+
+		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) noexcept
+			-> reference // @TODO: ISSUE #20
+		{
+			return buffer_[detail::index_2d_to_1d(leading_dimension_, row_index, col_index)];
+		}
+
+		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) const noexcept
+			-> const_reference // @TODO: ISSUE #20
+		{
+			return buffer_[detail::index_2d_to_1d(leading_dimension_, row_index, col_index)];
+		}
+	};
+} // namespace mpp
@@ -0,0 +1,154 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/detail/expr/expr_base.hpp>
+#include <mpp/detail/types/constraints.hpp>
+#include <mpp/detail/utility/public.hpp>
+#include <mpp/utility/configuration.hpp>
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace mpp
+{
+	/**
+	 * Number of elements stored by a symmetric matrix of the given size
+	 */
+	[[nodiscard]] constexpr auto packed_size(std::size_t size) noexcept -> std::size_t
+	{
+		return size * (size + 1) / 2;
+	}
+
+	/**
+	 * Square matrix equal to its transpose, which only stores its lower triangle packed row after row (row r takes
+	 * r + 1 elements), so it takes about half the memory of a dense matrix. Element (row, column) and
+	 * (column, row) are the same stored element, so writing either one keeps the matrix symmetric
+	 */
+	template<detail::arithmetic Value, typename Allocator = typename configuration<override>::allocator<Value>>
+	class symmetric_matrix : public detail::expr_base<symmetric_matrix<Value, Allocator>, Value, dynamic, dynamic>
+	{
+		std::vector<Value, Allocator> buffer_;
+		std::size_t size_{};
+
+		[[nodiscard]] static auto packed_index(std::size_t row_index, std::size_t col_index) noexcept
+			-> std::size_t // @TODO: ISSUE #20
+		{
+			if (col_index > row_index)
+			{
+				std::swap(row_index, col_index);
+			}
+
+			return packed_size(row_index) + col_index;
+		}
+
+	public:
+		using value_type      = Value;
+		using allocator_type  = Allocator;
+		using size_type       = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference       = Value&;
+		using const_reference = const Value&;
+
+		symmetric_matrix() = default;
+
+		explicit symmetric_matrix(std::size_t size,
+			const Value& value         = Value{},
+			const Allocator& allocator = Allocator{}) :
+			buffer_(packed_size(size), value, allocator),
+			size_(size) // @TODO: ISSUE #20
+		{
+		}
+
+		/**
+		 * Keeps the lower triangle of a square dense matrix (or an expression object), the upper one is expected to
+		 * mirror it
+		 */
+		template<typename Expr,
+			std::convertible_to<Value> ExprValue,
+			std::size_t ExprRowsExtent,
+			std::size_t ExprColumnsExtent>
+		explicit symmetric_matrix(const detail::expr_base<Expr, ExprValue, ExprRowsExtent, ExprColumnsExtent>& expr,
+			const Allocator& allocator = Allocator{}) :
+			buffer_(allocator),
+			size_(expr.rows()) // @TODO: ISSUE #20
+		{
+			assert(expr.rows() == expr.columns());
+
+			buffer_.reserve(packed_size(size_));
+
+			for (auto row = std::size_t{}; row < size_; ++row)
+			{
+				for (auto column = std::size_t{}; column <= row; ++column)
+				{
+					buffer_.push_back(static_cast<Value>(expr(row, column)));
+				}
+			}
+		}
+
+		[[nodiscard]] auto rows() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return size_;
+		}
+
+		[[nodiscard]] auto columns() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return size_;
+		}
+
+		/**
+		 * Packed lower triangle, with element (row, column) for column <= row at packed_size(row) + column
+		 */
+		[[nodiscard]] auto data() noexcept -> Value* // @TODO: ISSUE #20
+		{
+			return buffer_.data();
+		}
+
+		[[nodiscard]] auto data() const noexcept -> const Value* // @TODO: ISSUE #20
+		{
+			return buffer_.data();
+		}
+
+		[[nodiscard]] auto get_allocator() const noexcept -> Allocator // @TODO: ISSUE #20
+		{
+			return buffer_.get_allocator();
+		}
+
+		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) noexcept
+			-> reference // @TODO: ISSUE #20
+		{
+			assert(row_index < size_ && col_index < size_);
+
+			return buffer_[packed_index(row_index, col_index)];
+		}
+
+		[[nodiscard]] auto operator()(std::size_t row_index, std::size_t col_index) const noexcept
+			-> const_reference // @TODO: ISSUE #20
+		{
+			assert(row_index < size_ && col_index < size_);
+
+			return buffer_[packed_index(row_index, col_index)];
+		}
+	};
+} // namespace mpp
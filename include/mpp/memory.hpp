@@ -0,0 +1,31 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <mpp/memory/aligned_allocator.hpp>
+#include <mpp/memory/aligned_array.hpp>
+#include <mpp/memory/aligned_configuration.hpp>
+#include <mpp/memory/cow_buffer.hpp>
+#include <mpp/memory/default_init_allocator.hpp>
+#include <mpp/memory/huge_page_allocator.hpp>
+#include <mpp/memory/mapped_file.hpp>
+#include <mpp/memory/pool_allocator.hpp>
+#include <mpp/memory/sbo_buffer.hpp>
+#include <mpp/memory/workspace.hpp>
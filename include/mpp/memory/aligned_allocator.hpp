@@ -0,0 +1,87 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace mpp
+{
+	inline constexpr auto cache_line_alignment = std::size_t{ 64 };
+	inline constexpr auto page_alignment       = std::size_t{ 4096 };
+
+	/**
+	 * Allocator that over-aligns every allocation, so the first element of a buffer always starts on an Alignment
+	 * boundary (e.g. a cache line or a page)
+	 */
+	template<typename Value, std::size_t Alignment = cache_line_alignment>
+	class aligned_allocator
+	{
+		static_assert((Alignment & (Alignment - 1)) == 0, "Alignment has to be a power of 2");
+		static_assert(Alignment >= alignof(Value), "Alignment can't be weaker than the alignment of the value type");
+
+	public:
+		using value_type                             = Value;
+		using size_type                              = std::size_t;
+		using difference_type                        = std::ptrdiff_t;
+		using propagate_on_container_move_assignment = std::true_type;
+		using is_always_equal                        = std::true_type;
+
+		static constexpr auto alignment = Alignment;
+
+		// Has to be explicitly provided because of the non-type template parameter
+		template<typename Other>
+		struct rebind
+		{
+			using other = aligned_allocator<Other, Alignment>;
+		};
+
+		aligned_allocator() noexcept = default;
+
+		template<typename Other>
+		aligned_allocator(const aligned_allocator<Other, Alignment>&) noexcept // @TODO: ISSUE #20
+		{
+		}
+
+		[[nodiscard]] auto allocate(std::size_t size) -> Value* // @TODO: ISSUE #20
+		{
+			if (size > std::numeric_limits<std::size_t>::max() / sizeof(Value))
+			{
+				throw std::bad_array_new_length{};
+			}
+
+			return static_cast<Value*>(::operator new(size * sizeof(Value), std::align_val_t{ Alignment }));
+		}
+
+		void deallocate(Value* ptr, std::size_t size) noexcept // @TODO: ISSUE #20
+		{
+			::operator delete(ptr, size * sizeof(Value), std::align_val_t{ Alignment });
+		}
+
+		template<typename Other>
+		[[nodiscard]] friend auto operator==(const aligned_allocator&,
+			const aligned_allocator<Other, Alignment>&) noexcept -> bool // @TODO: ISSUE #20
+		{
+			return true;
+		}
+	};
+} // namespace mpp
@@ -0,0 +1,39 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <mpp/memory/aligned_allocator.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace mpp
+{
+	/**
+	 * std::array whose first element starts on an Alignment boundary, meant to be used as a static buffer
+	 */
+	template<typename Value, std::size_t Size, std::size_t Alignment = cache_line_alignment>
+	struct alignas(Alignment) aligned_array : public std::array<Value, Size>
+	{
+		static_assert((Alignment & (Alignment - 1)) == 0, "Alignment has to be a power of 2");
+
+		static constexpr auto alignment = Alignment;
+	};
+} // namespace mpp
@@ -0,0 +1,47 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <mpp/memory/aligned_allocator.hpp>
+#include <mpp/memory/aligned_array.hpp>
+#include <mpp/utility/configuration.hpp>
+
+#include <cstddef>
+
+namespace mpp
+{
+	/**
+	 * Configuration that over-aligns the buffers of every matrix. Use it by inheriting from it in the override:
+	 *
+	 * template<>
+	 * struct mpp::configuration<mpp::override> : mpp::aligned_configuration<mpp::cache_line_alignment>
+	 * {
+	 * };
+	 */
+	template<std::size_t Alignment = cache_line_alignment>
+	struct aligned_configuration : public configuration<void>
+	{
+		template<typename Value>
+		using allocator = aligned_allocator<Value, Alignment>;
+
+		template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename>
+		using static_buffer = aligned_array<Value, RowsExtent * ColumnsExtent, Alignment>;
+	};
+} // namespace mpp
@@ -0,0 +1,402 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/detail/types/type_traits.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mpp
+{
+	/**
+	 * Copy-on-write buffer: copies share the same elements, and a copy only gets its own elements the first time it's
+	 * accessed through a non-const member (data, begin, operator[], resize, ...) while still shared. Meant to be used
+	 * as a dynamic buffer for matrices that get copied around a lot but rarely modified (e.g. weights or configuration)
+	 *
+	 * Note that non-const accessors detach even when they are only used to read, so read shared matrices through const
+	 * references. Once a non-const accessor has handed out a reference, pointer or iterator (which views of a matrix
+	 * are built from), the elements are unshareable until the buffer is cleared or share() is called: copies get their
+	 * own elements right away, so writes through what was handed out never show up in them
+	 *
+	 * Copies can be modified on different threads. std::shared_ptr::use_count is a relaxed load, so a copy that finds
+	 * itself the last owner issues an acquire fence before writing, pairing with the release of the other copies'
+	 * reference count decrements: their reads of the elements happen before its writes. A stale count only makes a
+	 * copy copy its elements needlessly
+	 */
+	template<typename Value, typename Allocator = std::allocator<Value>>
+	class cow_buffer
+	{
+		using vector_type = std::vector<Value, Allocator>;
+
+		std::shared_ptr<vector_type> elements_;
+		[[no_unique_address]] Allocator allocator_;
+		bool shareable_ = true;
+
+		[[nodiscard]] auto copied_elements() const -> std::shared_ptr<vector_type> // @TODO: ISSUE #20
+		{
+			if (shareable_ || !elements_)
+			{
+				return elements_;
+			}
+
+			return std::make_shared<vector_type>(*elements_, allocator_);
+		}
+
+		[[nodiscard]] auto mutable_elements() -> vector_type& // @TODO: ISSUE #20
+		{
+			if (!elements_)
+			{
+				elements_ = std::make_shared<vector_type>(allocator_);
+			}
+			else if (elements_.use_count() > 1)
+			{
+				elements_ = std::make_shared<vector_type>(*elements_, allocator_);
+			}
+			else
+			{
+				// Other copies may have just been destroyed on another thread after reading the elements
+				std::atomic_thread_fence(std::memory_order_acquire);
+			}
+
+			return *elements_;
+		}
+
+		[[nodiscard]] auto handed_out_elements() -> vector_type& // @TODO: ISSUE #20
+		{
+			auto& elements = mutable_elements();
+			shareable_     = false;
+
+			return elements;
+		}
+
+	public:
+		using value_type             = Value;
+		using allocator_type         = Allocator;
+		using size_type              = std::size_t;
+		using difference_type        = std::ptrdiff_t;
+		using reference              = Value&;
+		using const_reference        = const Value&;
+		using pointer                = Value*;
+		using const_pointer          = const Value*;
+		using iterator               = Value*;
+		using const_iterator         = const Value*;
+		using reverse_iterator       = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+		cow_buffer() noexcept(std::is_nothrow_default_constructible_v<Allocator>) : cow_buffer(Allocator{}) {}
+
+		explicit cow_buffer(const Allocator& allocator) noexcept : allocator_(allocator) {} // @TODO: ISSUE #20
+
+		cow_buffer(std::size_t size, const Value& value, const Allocator& allocator = Allocator{}) :
+			elements_(std::make_shared<vector_type>(size, value, allocator)),
+			allocator_(allocator) // @TODO: ISSUE #20
+		{
+		}
+
+		cow_buffer(const cow_buffer& right) :
+			elements_(right.copied_elements()),
+			allocator_(right.allocator_) // @TODO: ISSUE #20
+		{
+		}
+
+		cow_buffer(const cow_buffer& right, const Allocator& allocator) : allocator_(allocator) // @TODO: ISSUE #20
+		{
+			// Elements can only be shared when they can be freed with either allocator
+			if (allocator_ == right.allocator_)
+			{
+				elements_ = right.copied_elements();
+			}
+			else if (right.elements_)
+			{
+				elements_ = std::make_shared<vector_type>(*right.elements_, allocator_);
+			}
+		}
+
+		cow_buffer(cow_buffer&&) noexcept = default;
+
+		cow_buffer(cow_buffer&& right, const Allocator& allocator) :
+			cow_buffer(std::as_const(right), allocator) // @TODO: ISSUE #20
+		{
+			right.elements_.reset();
+		}
+
+		auto operator=(const cow_buffer& right) -> cow_buffer& // @TODO: ISSUE #20
+		{
+			elements_  = right.copied_elements();
+			allocator_ = right.allocator_;
+			shareable_ = true;
+
+			return *this;
+		}
+
+		auto operator=(cow_buffer&&) noexcept -> cow_buffer& = default;
+
+		~cow_buffer() = default;
+
+		[[nodiscard]] auto get_allocator() const noexcept -> Allocator // @TODO: ISSUE #20
+		{
+			return allocator_;
+		}
+
+		/**
+		 * Whether the elements are shared with other buffers, i.e. whether the next non-const access copies them
+		 */
+		[[nodiscard]] auto is_shared() const noexcept -> bool // @TODO: ISSUE #20
+		{
+			return elements_.use_count() > 1;
+		}
+
+		/**
+		 * Whether copies share the elements, i.e. no reference, pointer or iterator to them has been handed out by a
+		 * non-const accessor since the last clear
+		 */
+		[[nodiscard]] auto is_shareable() const noexcept -> bool // @TODO: ISSUE #20
+		{
+			return shareable_;
+		}
+
+		/**
+		 * Makes the elements shareable again after a non-const accessor handed them out, once nothing writes through
+		 * the references, pointers or iterators it returned anymore (e.g. after filling a matrix through a view)
+		 */
+		void share() noexcept // @TODO: ISSUE #20
+		{
+			shareable_ = true;
+		}
+
+		[[nodiscard]] auto data() -> Value* // @TODO: ISSUE #20
+		{
+			return handed_out_elements().data();
+		}
+
+		[[nodiscard]] auto data() const noexcept -> const Value* // @TODO: ISSUE #20
+		{
+			return elements_ ? std::as_const(*elements_).data() : nullptr;
+		}
+
+		/**
+		 * Like data(), but for callers that are done with the pointer before the buffer is copied again, so the
+		 * elements stay shareable
+		 */
+		[[nodiscard]] auto scoped_data() -> Value* // @TODO: ISSUE #20
+		{
+			return mutable_elements().data();
+		}
+
+		[[nodiscard]] auto begin() -> iterator // @TODO: ISSUE #20
+		{
+			return data();
+		}
+
+		[[nodiscard]] auto begin() const noexcept -> const_iterator // @TODO: ISSUE #20
+		{
+			return data();
+		}
+
+		[[nodiscard]] auto end() -> iterator // @TODO: ISSUE #20
+		{
+			return data() + size();
+		}
+
+		[[nodiscard]] auto end() const noexcept -> const_iterator // @TODO: ISSUE #20
+		{
+			return data() + size();
+		}
+
+		[[nodiscard]] auto cbegin() const noexcept -> const_iterator // @TODO: ISSUE #20
+		{
+			return begin();
+		}
+
+		[[nodiscard]] auto cend() const noexcept -> const_iterator // @TODO: ISSUE #20
+		{
+			return end();
+		}
+
+		[[nodiscard]] auto rbegin() -> reverse_iterator // @TODO: ISSUE #20
+		{
+			return reverse_iterator{ end() };
+		}
+
+		[[nodiscard]] auto rbegin() const noexcept -> const_reverse_iterator // @TODO: ISSUE #20
+		{
+			return const_reverse_iterator{ end() };
+		}
+
+		[[nodiscard]] auto rend() -> reverse_iterator // @TODO: ISSUE #20
+		{
+			return reverse_iterator{ begin() };
+		}
+
+		[[nodiscard]] auto rend() const noexcept -> const_reverse_iterator // @TODO: ISSUE #20
+		{
+			return const_reverse_iterator{ begin() };
+		}
+
+		[[nodiscard]] auto crbegin() const noexcept -> const_reverse_iterator // @TODO: ISSUE #20
+		{
+			return rbegin();
+		}
+
+		[[nodiscard]] auto crend() const noexcept -> const_reverse_iterator // @TODO: ISSUE #20
+		{
+			return rend();
+		}
+
+		[[nodiscard]] auto operator[](std::size_t index) -> Value& // @TODO: ISSUE #20
+		{
+			return data()[index];
+		}
+
+		[[nodiscard]] auto operator[](std::size_t index) const noexcept -> const Value& // @TODO: ISSUE #20
+		{
+			return data()[index];
+		}
+
+		[[nodiscard]] auto front() -> Value& // @TODO: ISSUE #20
+		{
+			return handed_out_elements().front();
+		}
+
+		[[nodiscard]] auto front() const noexcept -> const Value& // @TODO: ISSUE #20
+		{
+			return data()[0];
+		}
+
+		[[nodiscard]] auto back() -> Value& // @TODO: ISSUE #20
+		{
+			return handed_out_elements().back();
+		}
+
+		[[nodiscard]] auto back() const noexcept -> const Value& // @TODO: ISSUE #20
+		{
+			return data()[size() - 1];
+		}
+
+		[[nodiscard]] auto size() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return elements_ ? elements_->size() : 0;
+		}
+
+		[[nodiscard]] auto max_size() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return std::allocator_traits<Allocator>::max_size(allocator_);
+		}
+
+		[[nodiscard]] auto capacity() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return elements_ ? elements_->capacity() : 0;
+		}
+
+		[[nodiscard]] auto empty() const noexcept -> bool // @TODO: ISSUE #20
+		{
+			return size() == 0;
+		}
+
+		void reserve(std::size_t new_capacity) // @TODO: ISSUE #20
+		{
+			if (new_capacity > capacity())
+			{
+				mutable_elements().reserve(new_capacity);
+			}
+		}
+
+		void shrink_to_fit() // @TODO: ISSUE #20
+		{
+			if (size() < capacity())
+			{
+				mutable_elements().shrink_to_fit();
+			}
+		}
+
+		void resize(std::size_t size) // @TODO: ISSUE #20
+		{
+			if (size != this->size())
+			{
+				mutable_elements().resize(size);
+			}
+		}
+
+		void resize(std::size_t size, const Value& value) // @TODO: ISSUE #20
+		{
+			if (size != this->size())
+			{
+				mutable_elements().resize(size, value);
+			}
+		}
+
+		template<typename... Args>
+		auto emplace_back(Args&&... args) -> Value& // @TODO: ISSUE #20
+		{
+			return handed_out_elements().emplace_back(std::forward<Args>(args)...);
+		}
+
+		void push_back(const Value& value) // @TODO: ISSUE #20
+		{
+			mutable_elements().push_back(value);
+		}
+
+		void push_back(Value&& value) // @TODO: ISSUE #20
+		{
+			mutable_elements().push_back(std::move(value));
+		}
+
+		void clear() noexcept // @TODO: ISSUE #20
+		{
+			// Nothing handed out survives clearing, so the elements can be shared again
+			shareable_ = true;
+
+			// Other buffers sharing the elements keep them, otherwise the capacity is kept like std::vector does
+			if (is_shared())
+			{
+				elements_.reset();
+			}
+			else if (elements_)
+			{
+				elements_->clear();
+			}
+		}
+
+		friend void swap(cow_buffer& left, cow_buffer& right) noexcept // @TODO: ISSUE #20
+		{
+			using std::swap;
+
+			swap(left.elements_, right.elements_);
+			swap(left.allocator_, right.allocator_);
+			swap(left.shareable_, right.shareable_);
+		}
+	};
+
+	namespace detail
+	{
+		// cow_buffer grows like std::vector, so the library treats it as one
+		template<typename Value, typename Allocator>
+		struct is_vector<cow_buffer<Value, Allocator>> : std::true_type
+		{
+		};
+	} // namespace detail
+} // namespace mpp
@@ -0,0 +1,76 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace mpp
+{
+	/**
+	 * Allocator adapter which default-initializes elements constructed without arguments instead of value-initializing
+	 * them, so resizing a vector of arithmetic values doesn't zero fill memory that is about to be overwritten
+	 */
+	template<typename Value, typename Allocator = std::allocator<Value>>
+	class default_init_allocator : public Allocator
+	{
+		using allocator_traits = std::allocator_traits<Allocator>;
+
+	public:
+		using value_type = Value;
+
+		// Has to be explicitly provided because the underlying allocator has to be rebound as well
+		template<typename Other>
+		struct rebind
+		{
+			using other = default_init_allocator<Other, typename allocator_traits::template rebind_alloc<Other>>;
+		};
+
+		using Allocator::Allocator;
+
+		default_init_allocator() = default;
+
+		explicit default_init_allocator(const Allocator& allocator) noexcept :
+			Allocator(allocator) // @TODO: ISSUE #20
+		{
+		}
+
+		template<typename Other, typename OtherAllocator>
+		default_init_allocator(const default_init_allocator<Other, OtherAllocator>& right) noexcept :
+			Allocator(static_cast<const OtherAllocator&>(right)) // @TODO: ISSUE #20
+		{
+		}
+
+		template<typename Other>
+		void construct(Other* ptr) noexcept(std::is_nothrow_default_constructible_v<Other>) // @TODO: ISSUE #20
+		{
+			::new (static_cast<void*>(ptr)) Other;
+		}
+
+		template<typename Other, typename... Args>
+		void construct(Other* ptr, Args&&... args) // @TODO: ISSUE #20
+		{
+			allocator_traits::construct(static_cast<Allocator&>(*this), ptr, std::forward<Args>(args)...);
+		}
+	};
+} // namespace mpp
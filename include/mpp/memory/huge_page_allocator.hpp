@@ -0,0 +1,123 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#if __has_include(<sys/mman.h>)
+	#include <sys/mman.h>
+#endif
+
+namespace mpp
+{
+	inline constexpr auto huge_page_size = std::size_t{ 2 * 1024 * 1024 };
+
+	/**
+	 * Allocator for big buffers, where TLB misses start to cost. Allocations of at least Threshold bytes are aligned to
+	 * and rounded up to whole huge pages, and the kernel is advised to back them with transparent huge pages where it
+	 * supports them (Linux). Smaller allocations, and platforms without the advice, get regular memory
+	 */
+	template<typename Value, std::size_t Threshold = huge_page_size>
+	class huge_page_allocator
+	{
+		[[nodiscard]] static constexpr auto is_huge(std::size_t bytes) noexcept -> bool
+		{
+			return bytes >= Threshold;
+		}
+
+		[[nodiscard]] static constexpr auto round_to_huge_pages(std::size_t bytes) noexcept -> std::size_t
+		{
+			return (bytes + huge_page_size - 1) / huge_page_size * huge_page_size;
+		}
+
+	public:
+		using value_type                             = Value;
+		using size_type                              = std::size_t;
+		using difference_type                        = std::ptrdiff_t;
+		using propagate_on_container_move_assignment = std::true_type;
+		using is_always_equal                        = std::true_type;
+
+		static constexpr auto threshold = Threshold;
+
+		// Has to be explicitly provided because of the non-type template parameter
+		template<typename Other>
+		struct rebind
+		{
+			using other = huge_page_allocator<Other, Threshold>;
+		};
+
+		huge_page_allocator() noexcept = default;
+
+		template<typename Other>
+		huge_page_allocator(const huge_page_allocator<Other, Threshold>&) noexcept // @TODO: ISSUE #20
+		{
+		}
+
+		[[nodiscard]] auto allocate(std::size_t size) -> Value* // @TODO: ISSUE #20
+		{
+			if (size > (std::numeric_limits<std::size_t>::max() - huge_page_size) / sizeof(Value))
+			{
+				throw std::bad_array_new_length{};
+			}
+
+			const auto bytes = size * sizeof(Value);
+
+			if (!is_huge(bytes))
+			{
+				return static_cast<Value*>(::operator new(bytes, std::align_val_t{ alignof(Value) }));
+			}
+
+			const auto huge_bytes = round_to_huge_pages(bytes);
+			const auto ptr        = ::operator new(huge_bytes, std::align_val_t{ huge_page_size });
+
+#ifdef MADV_HUGEPAGE
+			// Only a hint: the memory is usable whether the kernel follows it or not
+			::madvise(ptr, huge_bytes, MADV_HUGEPAGE);
+#endif
+
+			return static_cast<Value*>(ptr);
+		}
+
+		void deallocate(Value* ptr, std::size_t size) noexcept // @TODO: ISSUE #20
+		{
+			const auto bytes = size * sizeof(Value);
+
+			if (!is_huge(bytes))
+			{
+				::operator delete(ptr, bytes, std::align_val_t{ alignof(Value) });
+			}
+			else
+			{
+				::operator delete(ptr, round_to_huge_pages(bytes), std::align_val_t{ huge_page_size });
+			}
+		}
+
+		template<typename Other>
+		[[nodiscard]] friend auto operator==(const huge_page_allocator&,
+			const huge_page_allocator<Other, Threshold>&) noexcept -> bool // @TODO: ISSUE #20
+		{
+			return true;
+		}
+	};
+} // namespace mpp
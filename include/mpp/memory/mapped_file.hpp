@@ -0,0 +1,202 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#if __has_include(<sys/mman.h>)
+	#define MPP_HAS_MAPPED_FILE 1
+
+	#include <cerrno>
+	#include <cstddef>
+	#include <filesystem>
+	#include <system_error>
+	#include <utility>
+
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+
+namespace mpp
+{
+	enum class mapped_file_mode
+	{
+		read_only,
+		read_write,
+		create // Creates (or truncates) the file with the requested size, then maps it read-write
+	};
+
+	/**
+	 * Whole file mapped into memory (POSIX only). Pages are loaded from the file when they are first touched, and
+	 * writes to a read-write mapping go back to the file through the page cache, so nothing is read upfront
+	 *
+	 * Failing to open or map the file throws std::system_error
+	 */
+	class mapped_file
+	{
+		std::byte* data_  = nullptr;
+		std::size_t size_ = 0;
+
+		[[noreturn]] static void throw_errno(const char* what)
+		{
+			throw std::system_error(errno, std::generic_category(), what);
+		}
+
+	public:
+		mapped_file() noexcept = default; // @TODO: ISSUE #20
+
+		mapped_file(const std::filesystem::path& path,
+			mapped_file_mode mode,
+			std::size_t size = 0) // @TODO: ISSUE #20
+		{
+			const auto writable = mode != mapped_file_mode::read_only;
+			const auto flags    = mode == mapped_file_mode::create ? O_RDWR | O_CREAT | O_TRUNC
+																   : (writable ? O_RDWR : O_RDONLY);
+
+			const auto file = ::open(path.c_str(), flags, 0644);
+
+			if (file == -1)
+			{
+				throw_errno("mpp::mapped_file: open");
+			}
+
+			// The mapping keeps its own reference to the file, so the descriptor is closed no matter what happens next
+			struct file_closer
+			{
+				int file;
+
+				~file_closer()
+				{
+					::close(file);
+				}
+			} closer{ file };
+
+			if (mode == mapped_file_mode::create)
+			{
+				if (::ftruncate(file, static_cast<off_t>(size)) == -1)
+				{
+					throw_errno("mpp::mapped_file: ftruncate");
+				}
+			}
+			else
+			{
+				struct stat file_stat
+				{
+				};
+
+				if (::fstat(file, &file_stat) == -1)
+				{
+					throw_errno("mpp::mapped_file: fstat");
+				}
+
+				size = static_cast<std::size_t>(file_stat.st_size);
+			}
+
+			// Mapping an empty file fails, and there's nothing to refer to anyway
+			if (size == 0)
+			{
+				return;
+			}
+
+			const auto protection = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+			const auto mapping    = ::mmap(nullptr, size, protection, MAP_SHARED, file, 0);
+
+			if (mapping == MAP_FAILED)
+			{
+				throw_errno("mpp::mapped_file: mmap");
+			}
+
+			data_ = static_cast<std::byte*>(mapping);
+			size_ = size;
+		}
+
+		mapped_file(const mapped_file&) = delete;
+		auto operator=(const mapped_file&) -> mapped_file& = delete;
+
+		mapped_file(mapped_file&& right) noexcept :
+			data_(std::exchange(right.data_, nullptr)),
+			size_(std::exchange(right.size_, 0)) // @TODO: ISSUE #20
+		{
+		}
+
+		auto operator=(mapped_file&& right) noexcept -> mapped_file& // @TODO: ISSUE #20
+		{
+			if (this != &right)
+			{
+				unmap();
+
+				data_ = std::exchange(right.data_, nullptr);
+				size_ = std::exchange(right.size_, 0);
+			}
+
+			return *this;
+		}
+
+		~mapped_file()
+		{
+			unmap();
+		}
+
+		[[nodiscard]] auto data() const noexcept -> std::byte* // @TODO: ISSUE #20
+		{
+			return data_;
+		}
+
+		[[nodiscard]] auto size() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return size_;
+		}
+
+		/**
+		 * Tells the kernel the mapping is going to be swept once from start to end, so it reads ahead aggressively and
+		 * can drop the pages behind the sweep
+		 */
+		void advise_sequential() const noexcept // @TODO: ISSUE #20
+		{
+			if (data_ != nullptr)
+			{
+				::madvise(data_, size_, MADV_SEQUENTIAL);
+			}
+		}
+
+		/**
+		 * Writes dirty pages back to the file and waits for it, which otherwise happens whenever the kernel decides to
+		 */
+		void flush() const // @TODO: ISSUE #20
+		{
+			if (data_ != nullptr && ::msync(data_, size_, MS_SYNC) == -1)
+			{
+				throw_errno("mpp::mapped_file: msync");
+			}
+		}
+
+		void unmap() noexcept // @TODO: ISSUE #20
+		{
+			if (data_ != nullptr)
+			{
+				::munmap(data_, size_);
+
+				data_ = nullptr;
+				size_ = 0;
+			}
+		}
+	};
+} // namespace mpp
+#endif
@@ -0,0 +1,290 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/memory/aligned_allocator.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace mpp
+{
+	/**
+	 * Cache of freed blocks sorted in size classes, for programs creating and destroying lots of buffers of the same
+	 * sizes. Freed blocks are kept for the next allocation of the same class instead of being given back, so in a
+	 * steady state allocating is popping a free list
+	 *
+	 * Classes are 16 bytes apart up to 64 bytes, then split every power of 2 in 4 (so at most 25% is wasted), up to
+	 * max_pooled_bytes. Bigger allocations aren't pooled. Every block is allocated on its own, so a block can be freed
+	 * into any pool, and each pool keeps a bounded amount of memory per class
+	 */
+	class pool_resource
+	{
+		struct free_block
+		{
+			free_block* next;
+		};
+
+		struct size_class
+		{
+			free_block* head = nullptr;
+			std::size_t cached_blocks{};
+		};
+
+	public:
+		static constexpr auto alignment           = cache_line_alignment;
+		static constexpr auto max_pooled_bytes    = std::size_t{ 1024 * 1024 };
+		static constexpr auto max_cached_bytes    = std::size_t{ 8 * 1024 * 1024 }; // Per class
+		static constexpr auto min_cached_blocks   = std::size_t{ 16 };
+		static constexpr auto small_class_step    = std::size_t{ 16 };
+		static constexpr auto small_class_count   = std::size_t{ 4 };
+		static constexpr auto classes_per_power   = std::size_t{ 4 };
+		static constexpr auto first_large_power   = std::size_t{ 6 }; // First power of 2 after the small classes
+		static constexpr auto max_pooled_power    = std::size_t{ 20 };
+		static constexpr auto class_count         = small_class_count +
+			(max_pooled_power - first_large_power) * classes_per_power;
+
+		[[nodiscard]] static constexpr auto class_index(std::size_t bytes) noexcept -> std::size_t
+		{
+			// Preconditions:
+			// 0 < bytes <= max_pooled_bytes
+
+			if (bytes <= small_class_step * small_class_count)
+			{
+				return (bytes + small_class_step - 1) / small_class_step - 1;
+			}
+
+			// 2^power < bytes <= 2^(power + 1)
+			const auto power = static_cast<std::size_t>(std::bit_width(bytes - 1)) - 1;
+			const auto step  = (std::size_t{ 1 } << power) / classes_per_power;
+			const auto sub   = (bytes - (std::size_t{ 1 } << power) + step - 1) / step;
+
+			return small_class_count + (power - first_large_power) * classes_per_power + sub - 1;
+		}
+
+		[[nodiscard]] static constexpr auto class_size(std::size_t index) noexcept -> std::size_t
+		{
+			if (index < small_class_count)
+			{
+				return (index + 1) * small_class_step;
+			}
+
+			const auto large_index = index - small_class_count;
+			const auto power       = first_large_power + large_index / classes_per_power;
+			const auto step        = (std::size_t{ 1 } << power) / classes_per_power;
+
+			return (std::size_t{ 1 } << power) + (large_index % classes_per_power + 1) * step;
+		}
+
+		[[nodiscard]] static constexpr auto is_pooled(std::size_t bytes) noexcept -> bool
+		{
+			return bytes > 0 && bytes <= max_pooled_bytes;
+		}
+
+		/**
+		 * Frees a block directly, without caching it
+		 */
+		static void release_block(void* ptr, std::size_t bytes) noexcept // @TODO: ISSUE #20
+		{
+			const auto size = is_pooled(bytes) ? class_size(class_index(bytes)) : bytes;
+
+			::operator delete(ptr, size, std::align_val_t{ alignment });
+		}
+
+	private:
+		std::array<size_class, class_count> classes_{};
+
+	public:
+		pool_resource() noexcept = default;
+
+		pool_resource(const pool_resource&) = delete;
+		auto operator=(const pool_resource&) -> pool_resource& = delete;
+
+		~pool_resource()
+		{
+			release();
+		}
+
+		[[nodiscard]] auto allocate(std::size_t bytes) -> void* // @TODO: ISSUE #20
+		{
+			if (!is_pooled(bytes))
+			{
+				return ::operator new(bytes, std::align_val_t{ alignment });
+			}
+
+			const auto index = class_index(bytes);
+			auto& cls        = classes_[index];
+
+			if (cls.head != nullptr)
+			{
+				const auto block = cls.head;
+
+				cls.head = block->next;
+				--cls.cached_blocks;
+
+				return block;
+			}
+
+			return ::operator new(class_size(index), std::align_val_t{ alignment });
+		}
+
+		void deallocate(void* ptr, std::size_t bytes) noexcept // @TODO: ISSUE #20
+		{
+			if (!is_pooled(bytes))
+			{
+				release_block(ptr, bytes);
+				return;
+			}
+
+			const auto index = class_index(bytes);
+			auto& cls        = classes_[index];
+
+			if (cls.cached_blocks >= (std::max)(max_cached_bytes / class_size(index), min_cached_blocks))
+			{
+				release_block(ptr, bytes);
+				return;
+			}
+
+			cls.head = ::new (ptr) free_block{ cls.head };
+			++cls.cached_blocks;
+		}
+
+		/**
+		 * Gives every cached block back
+		 */
+		void release() noexcept // @TODO: ISSUE #20
+		{
+			for (auto index = std::size_t{}; index < class_count; ++index)
+			{
+				auto& cls = classes_[index];
+
+				while (cls.head != nullptr)
+				{
+					const auto next = cls.head->next;
+
+					::operator delete(cls.head, class_size(index), std::align_val_t{ alignment });
+					cls.head = next;
+				}
+
+				cls.cached_blocks = 0;
+			}
+		}
+
+		[[nodiscard]] auto cached_blocks() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			auto count = std::size_t{};
+
+			for (const auto& cls : classes_)
+			{
+				count += cls.cached_blocks;
+			}
+
+			return count;
+		}
+	};
+
+	namespace detail
+	{
+		// Set once the pool of the calling thread is gone (e.g. while destroying other thread locals), so later
+		// deallocations free their blocks directly
+		inline thread_local constinit auto thread_pool_destroyed = false;
+
+		struct thread_pool_holder
+		{
+			pool_resource pool;
+
+			~thread_pool_holder()
+			{
+				thread_pool_destroyed = true;
+			}
+		};
+	} // namespace detail
+
+	/**
+	 * Pool owned by the calling thread, so pool allocators never have to synchronize
+	 */
+	[[nodiscard]] inline auto thread_pool_resource() -> pool_resource& // @TODO: ISSUE #20
+	{
+		thread_local auto holder = detail::thread_pool_holder{};
+
+		return holder.pool;
+	}
+
+	/**
+	 * Allocator drawing from the pool of the calling thread. Buffers can be freed from any thread, their block then
+	 * goes to the pool of that thread. Allocations are cache line aligned
+	 */
+	template<typename Value>
+	class pool_allocator
+	{
+	public:
+		using value_type                             = Value;
+		using size_type                              = std::size_t;
+		using difference_type                        = std::ptrdiff_t;
+		using propagate_on_container_move_assignment = std::true_type;
+		using is_always_equal                        = std::true_type;
+
+		static constexpr auto alignment = pool_resource::alignment;
+
+		static_assert(alignment >= alignof(Value), "Over-aligned value types can't be pooled");
+
+		pool_allocator() noexcept = default;
+
+		template<typename Other>
+		pool_allocator(const pool_allocator<Other>&) noexcept // @TODO: ISSUE #20
+		{
+		}
+
+		[[nodiscard]] auto allocate(std::size_t size) -> Value* // @TODO: ISSUE #20
+		{
+			if (size > std::numeric_limits<std::size_t>::max() / sizeof(Value))
+			{
+				throw std::bad_array_new_length{};
+			}
+
+			return static_cast<Value*>(thread_pool_resource().allocate(size * sizeof(Value)));
+		}
+
+		void deallocate(Value* ptr, std::size_t size) noexcept // @TODO: ISSUE #20
+		{
+			if (detail::thread_pool_destroyed)
+			{
+				pool_resource::release_block(ptr, size * sizeof(Value));
+			}
+			else
+			{
+				thread_pool_resource().deallocate(ptr, size * sizeof(Value));
+			}
+		}
+
+		template<typename Other>
+		[[nodiscard]] friend auto operator==(const pool_allocator&,
+			const pool_allocator<Other>&) noexcept -> bool // @TODO: ISSUE #20
+		{
+			return true;
+		}
+	};
+} // namespace mpp
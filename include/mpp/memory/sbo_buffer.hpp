@@ -0,0 +1,511 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <mpp/detail/types/type_traits.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace mpp
+{
+	/**
+	 * Contiguous buffer with a vector-like interface that keeps up to InlineCapacity elements inside the object and
+	 * only allocates when it grows past that, meant to be used as a dynamic buffer for matrices that are usually tiny
+	 */
+	template<typename Value, std::size_t InlineCapacity, typename Allocator = std::allocator<Value>>
+	class sbo_buffer
+	{
+		using alloc_traits = std::allocator_traits<Allocator>;
+
+		static_assert(std::is_same_v<typename alloc_traits::pointer, Value*>, "Fancy pointers are not supported");
+
+		[[no_unique_address]] Allocator allocator_;
+
+		Value* data_;
+		std::size_t size_{};
+		std::size_t capacity_{ InlineCapacity };
+
+		static constexpr auto inline_bytes = (std::max)(InlineCapacity * sizeof(Value), std::size_t{ 1 });
+
+		alignas(detail::allocator_alignment<Allocator>::value) std::array<std::byte, inline_bytes> inline_;
+
+		[[nodiscard]] auto inline_data() noexcept -> Value*
+		{
+			return reinterpret_cast<Value*>(inline_.data());
+		}
+
+		[[nodiscard]] auto is_inline() const noexcept -> bool
+		{
+			return capacity_ == InlineCapacity;
+		}
+
+		void destroy_elements() noexcept
+		{
+			std::destroy_n(data_, size_);
+			size_ = 0;
+		}
+
+		void deallocate_if_heap() noexcept
+		{
+			if (!is_inline())
+			{
+				alloc_traits::deallocate(allocator_, data_, capacity_);
+
+				data_     = inline_data();
+				capacity_ = InlineCapacity;
+			}
+		}
+
+		void reallocate(std::size_t new_capacity) // @TODO: ISSUE #20
+		{
+			// Preconditions:
+			// new_capacity >= size_
+
+			auto new_data = new_capacity > InlineCapacity ? alloc_traits::allocate(allocator_, new_capacity)
+														  : inline_data();
+
+			// Moving into the inline storage only happens when shrinking from the heap, so the ranges never overlap
+			std::uninitialized_move_n(data_, size_, new_data);
+			std::destroy_n(data_, size_);
+
+			if (!is_inline())
+			{
+				alloc_traits::deallocate(allocator_, data_, capacity_);
+			}
+
+			data_     = new_data;
+			capacity_ = (std::max)(new_capacity, InlineCapacity);
+		}
+
+		[[nodiscard]] auto grown_capacity(std::size_t size) const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			// Geometric growth to keep push_back amortized constant
+			return (std::max)(size, capacity_ * 2);
+		}
+
+		template<typename ConstructTail>
+		void reallocate_with_tail(std::size_t new_capacity, std::size_t tail_size, ConstructTail&& construct_tail)
+		{
+			// Preconditions:
+			// new_capacity > capacity_ and new_capacity >= size_ + tail_size
+
+			// The tail is built before the old elements are moved away, so arguments that refer into this buffer
+			// (e.g. buf.push_back(buf[0])) are still alive while it's constructed
+			auto new_data = alloc_traits::allocate(allocator_, new_capacity);
+
+			try
+			{
+				construct_tail(new_data + size_);
+			}
+			catch (...)
+			{
+				alloc_traits::deallocate(allocator_, new_data, new_capacity);
+				throw;
+			}
+
+			try
+			{
+				std::uninitialized_move_n(data_, size_, new_data);
+			}
+			catch (...)
+			{
+				std::destroy_n(new_data + size_, tail_size);
+				alloc_traits::deallocate(allocator_, new_data, new_capacity);
+				throw;
+			}
+
+			std::destroy_n(data_, size_);
+
+			if (!is_inline())
+			{
+				alloc_traits::deallocate(allocator_, data_, capacity_);
+			}
+
+			data_     = new_data;
+			size_     = size_ + tail_size;
+			capacity_ = new_capacity;
+		}
+
+		void steal_or_move_from(sbo_buffer&& right) // @TODO: ISSUE #20
+		{
+			// Preconditions:
+			// This buffer is empty and inline
+
+			if (!right.is_inline() && allocator_ == right.allocator_)
+			{
+				data_     = std::exchange(right.data_, right.inline_data());
+				size_     = std::exchange(right.size_, 0);
+				capacity_ = std::exchange(right.capacity_, InlineCapacity);
+			}
+			else
+			{
+				reserve(right.size_);
+				std::uninitialized_move_n(right.data_, right.size_, data_);
+				size_ = right.size_;
+
+				right.clear();
+			}
+		}
+
+	public:
+		using value_type             = Value;
+		using allocator_type         = Allocator;
+		using size_type              = std::size_t;
+		using difference_type        = std::ptrdiff_t;
+		using reference              = Value&;
+		using const_reference        = const Value&;
+		using pointer                = Value*;
+		using const_pointer          = const Value*;
+		using iterator               = Value*;
+		using const_iterator         = const Value*;
+		using reverse_iterator       = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+		static constexpr auto inline_capacity = InlineCapacity;
+
+		// The inline storage is as aligned as the allocations, so it doesn't weaken over-aligned allocators
+		static constexpr auto alignment = detail::allocator_alignment<Allocator>::value;
+
+		sbo_buffer() noexcept(std::is_nothrow_default_constructible_v<Allocator>) : sbo_buffer(Allocator{}) {}
+
+		explicit sbo_buffer(const Allocator& allocator) noexcept : allocator_(allocator), data_(inline_data()) {}
+
+		sbo_buffer(std::size_t size, const Value& value, const Allocator& allocator = Allocator{}) :
+			sbo_buffer(allocator) // @TODO: ISSUE #20
+		{
+			resize(size, value);
+		}
+
+		sbo_buffer(const sbo_buffer& right) :
+			sbo_buffer(right, alloc_traits::select_on_container_copy_construction(right.allocator_))
+		{
+		}
+
+		sbo_buffer(const sbo_buffer& right, const Allocator& allocator) :
+			sbo_buffer(allocator) // @TODO: ISSUE #20
+		{
+			reserve(right.size_);
+			std::uninitialized_copy_n(right.data_, right.size_, data_);
+			size_ = right.size_;
+		}
+
+		sbo_buffer(sbo_buffer&& right) noexcept(std::is_nothrow_move_constructible_v<Value>) :
+			sbo_buffer(right.allocator_) // @TODO: ISSUE #20
+		{
+			steal_or_move_from(std::move(right));
+		}
+
+		sbo_buffer(sbo_buffer&& right, const Allocator& allocator) : sbo_buffer(allocator) // @TODO: ISSUE #20
+		{
+			steal_or_move_from(std::move(right));
+		}
+
+		auto operator=(const sbo_buffer& right) -> sbo_buffer& // @TODO: ISSUE #20
+		{
+			if (&right != this)
+			{
+				clear();
+
+				if constexpr (alloc_traits::propagate_on_container_copy_assignment::value)
+				{
+					if (allocator_ != right.allocator_)
+					{
+						deallocate_if_heap();
+					}
+
+					allocator_ = right.allocator_;
+				}
+
+				reserve(right.size_);
+				std::uninitialized_copy_n(right.data_, right.size_, data_);
+				size_ = right.size_;
+			}
+
+			return *this;
+		}
+
+		// Heap storage is only stolen when the allocators end up equal, otherwise the elements are moved one by one
+		// into freshly allocated storage, which can throw
+		auto operator=(sbo_buffer&& right) noexcept(
+			(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) &&
+			std::is_nothrow_move_constructible_v<Value>) -> sbo_buffer& // @TODO: ISSUE #20
+		{
+			if (&right != this)
+			{
+				clear();
+				deallocate_if_heap();
+
+				if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+				{
+					allocator_ = std::move(right.allocator_);
+				}
+
+				steal_or_move_from(std::move(right));
+			}
+
+			return *this;
+		}
+
+		~sbo_buffer()
+		{
+			destroy_elements();
+			deallocate_if_heap();
+		}
+
+		[[nodiscard]] auto get_allocator() const noexcept -> Allocator // @TODO: ISSUE #20
+		{
+			return allocator_;
+		}
+
+		[[nodiscard]] auto data() noexcept -> Value* // @TODO: ISSUE #20
+		{
+			return data_;
+		}
+
+		[[nodiscard]] auto data() const noexcept -> const Value* // @TODO: ISSUE #20
+		{
+			return data_;
+		}
+
+		[[nodiscard]] auto begin() noexcept -> iterator // @TODO: ISSUE #20
+		{
+			return data_;
+		}
+
+		[[nodiscard]] auto begin() const noexcept -> const_iterator // @TODO: ISSUE #20
+		{
+			return data_;
+		}
+
+		[[nodiscard]] auto end() noexcept -> iterator // @TODO: ISSUE #20
+		{
+			return data_ + size_;
+		}
+
+		[[nodiscard]] auto end() const noexcept -> const_iterator // @TODO: ISSUE #20
+		{
+			return data_ + size_;
+		}
+
+		[[nodiscard]] auto cbegin() const noexcept -> const_iterator // @TODO: ISSUE #20
+		{
+			return begin();
+		}
+
+		[[nodiscard]] auto cend() const noexcept -> const_iterator // @TODO: ISSUE #20
+		{
+			return end();
+		}
+
+		[[nodiscard]] auto rbegin() noexcept -> reverse_iterator // @TODO: ISSUE #20
+		{
+			return reverse_iterator{ end() };
+		}
+
+		[[nodiscard]] auto rbegin() const noexcept -> const_reverse_iterator // @TODO: ISSUE #20
+		{
+			return const_reverse_iterator{ end() };
+		}
+
+		[[nodiscard]] auto rend() noexcept -> reverse_iterator // @TODO: ISSUE #20
+		{
+			return reverse_iterator{ begin() };
+		}
+
+		[[nodiscard]] auto rend() const noexcept -> const_reverse_iterator // @TODO: ISSUE #20
+		{
+			return const_reverse_iterator{ begin() };
+		}
+
+		[[nodiscard]] auto crbegin() const noexcept -> const_reverse_iterator // @TODO: ISSUE #20
+		{
+			return rbegin();
+		}
+
+		[[nodiscard]] auto crend() const noexcept -> const_reverse_iterator // @TODO: ISSUE #20
+		{
+			return rend();
+		}
+
+		[[nodiscard]] auto operator[](std::size_t index) noexcept -> Value& // @TODO: ISSUE #20
+		{
+			return data_[index];
+		}
+
+		[[nodiscard]] auto operator[](std::size_t index) const noexcept -> const Value& // @TODO: ISSUE #20
+		{
+			return data_[index];
+		}
+
+		[[nodiscard]] auto front() noexcept -> Value& // @TODO: ISSUE #20
+		{
+			return data_[0];
+		}
+
+		[[nodiscard]] auto front() const noexcept -> const Value& // @TODO: ISSUE #20
+		{
+			return data_[0];
+		}
+
+		[[nodiscard]] auto back() noexcept -> Value& // @TODO: ISSUE #20
+		{
+			return data_[size_ - 1];
+		}
+
+		[[nodiscard]] auto back() const noexcept -> const Value& // @TODO: ISSUE #20
+		{
+			return data_[size_ - 1];
+		}
+
+		[[nodiscard]] auto size() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return size_;
+		}
+
+		[[nodiscard]] auto max_size() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return alloc_traits::max_size(allocator_);
+		}
+
+		[[nodiscard]] auto capacity() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return capacity_;
+		}
+
+		[[nodiscard]] auto empty() const noexcept -> bool // @TODO: ISSUE #20
+		{
+			return size_ == 0;
+		}
+
+		[[nodiscard]] auto is_heap_allocated() const noexcept -> bool // @TODO: ISSUE #20
+		{
+			return !is_inline();
+		}
+
+		void reserve(std::size_t new_capacity) // @TODO: ISSUE #20
+		{
+			if (new_capacity > capacity_)
+			{
+				reallocate(new_capacity);
+			}
+		}
+
+		void shrink_to_fit() // @TODO: ISSUE #20
+		{
+			if (!is_inline() && size_ < capacity_)
+			{
+				reallocate(size_);
+			}
+		}
+
+		void resize(std::size_t size) // @TODO: ISSUE #20
+		{
+			if (size > size_)
+			{
+				reserve(size);
+				std::uninitialized_value_construct_n(data_ + size_, size - size_);
+			}
+			else
+			{
+				std::destroy_n(data_ + size, size_ - size);
+			}
+
+			size_ = size;
+		}
+
+		void resize(std::size_t size, const Value& value) // @TODO: ISSUE #20
+		{
+			if (size > capacity_)
+			{
+				// value may refer into this buffer, so it's copied before the old storage is released
+				reallocate_with_tail(size, size - size_, [&](Value* tail) {
+					std::uninitialized_fill_n(tail, size - size_, value);
+				});
+			}
+			else if (size > size_)
+			{
+				std::uninitialized_fill_n(data_ + size_, size - size_, value);
+				size_ = size;
+			}
+			else
+			{
+				std::destroy_n(data_ + size, size_ - size);
+				size_ = size;
+			}
+		}
+
+		template<typename... Args>
+		auto emplace_back(Args&&... args) -> Value& // @TODO: ISSUE #20
+		{
+			if (size_ == capacity_)
+			{
+				// args may refer into this buffer, so the new element is built before the old storage is released
+				reallocate_with_tail(grown_capacity(size_ + 1), 1, [&](Value* tail) {
+					std::construct_at(tail, std::forward<Args>(args)...);
+				});
+
+				return back();
+			}
+
+			auto element = std::construct_at(data_ + size_, std::forward<Args>(args)...);
+			++size_;
+
+			return *element;
+		}
+
+		void push_back(const Value& value) // @TODO: ISSUE #20
+		{
+			emplace_back(value);
+		}
+
+		void push_back(Value&& value) // @TODO: ISSUE #20
+		{
+			emplace_back(std::move(value));
+		}
+
+		void clear() noexcept // @TODO: ISSUE #20
+		{
+			destroy_elements();
+		}
+
+		friend void swap(sbo_buffer& left, sbo_buffer& right) // @TODO: ISSUE #20
+		{
+			auto temp = std::move(left);
+			left      = std::move(right);
+			right     = std::move(temp);
+		}
+	};
+
+	namespace detail
+	{
+		// sbo_buffer grows like std::vector, so the library treats it as one
+		template<typename Value, std::size_t InlineCapacity, typename Allocator>
+		struct is_vector<sbo_buffer<Value, InlineCapacity, Allocator>> : std::true_type
+		{
+		};
+	} // namespace detail
+} // namespace mpp
@@ -0,0 +1,302 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace mpp
+{
+	/**
+	 * Monotonic arena for temporaries. Allocations only bump a pointer and memory is only given back by rewinding, so
+	 * once a workspace has grown to fit a computation, repeating it doesn't allocate anymore
+	 */
+	class workspace
+	{
+		struct block
+		{
+			std::unique_ptr<std::byte[]> data;
+			std::size_t size;
+		};
+
+		std::vector<block> blocks_;
+		std::size_t current_block_{};
+		std::size_t offset_{};
+		std::size_t retained_capacity_ = (std::numeric_limits<std::size_t>::max)();
+
+		void add_block(std::size_t min_size) // @TODO: ISSUE #20
+		{
+			// Geometric growth so the number of blocks stays logarithmic
+			const auto size = (std::max)(min_size, capacity());
+
+			blocks_.push_back({ std::make_unique_for_overwrite<std::byte[]>(size), size });
+		}
+
+	public:
+		/**
+		 * Position of a workspace which it can be rewound to
+		 */
+		struct marker
+		{
+			std::size_t block;
+			std::size_t offset;
+		};
+
+		workspace() noexcept = default;
+
+		explicit workspace(std::size_t initial_bytes) // @TODO: ISSUE #20
+		{
+			if (initial_bytes > 0)
+			{
+				add_block(initial_bytes);
+			}
+		}
+
+		workspace(const workspace&) = delete;
+		workspace(workspace&&)      = default;
+
+		auto operator=(const workspace&) -> workspace& = delete;
+		auto operator=(workspace&&) -> workspace&      = default;
+
+		[[nodiscard]] auto allocate(std::size_t bytes, std::size_t alignment) -> void* // @TODO: ISSUE #20
+		{
+			for (; current_block_ < blocks_.size(); ++current_block_, offset_ = 0)
+			{
+				auto& current    = blocks_[current_block_];
+				auto space       = current.size - offset_;
+				void* allocation = current.data.get() + offset_;
+
+				if (std::align(alignment, bytes, allocation, space) != nullptr)
+				{
+					offset_ = current.size - space + bytes;
+					return allocation;
+				}
+			}
+
+			// Worst case alignment padding is alignment - 1 bytes
+			add_block(bytes + alignment - 1);
+
+			current_block_ = blocks_.size() - 1;
+			offset_        = 0;
+
+			return allocate(bytes, alignment);
+		}
+
+		[[nodiscard]] auto current_marker() const noexcept -> marker // @TODO: ISSUE #20
+		{
+			return { current_block_, offset_ };
+		}
+
+		void rewind(marker position) noexcept // @TODO: ISSUE #20
+		{
+			current_block_ = position.block;
+			offset_        = position.offset;
+		}
+
+		/**
+		 * Releases everything allocated from the workspace. If it had to grow into several blocks, they're merged into
+		 * one, so the next computation of the same size is served from a single block. A workspace grown past its
+		 * retained capacity frees its blocks instead. Merging is best-effort: if the merged block can't be allocated,
+		 * the blocks are kept as they are, since reset() runs from the destructor of workspace_scope
+		 */
+		void reset() noexcept // @TODO: ISSUE #20
+		{
+			if (const auto total_size = capacity(); total_size > retained_capacity_)
+			{
+				blocks_.clear();
+			}
+			else if (blocks_.size() > 1)
+			{
+				try
+				{
+					auto merged = block{ std::make_unique_for_overwrite<std::byte[]>(total_size), total_size };
+
+					// Doesn't allocate, the vector keeps its capacity when cleared
+					blocks_.clear();
+					blocks_.push_back(std::move(merged));
+				}
+				catch (const std::bad_alloc&)
+				{
+					// The blocks are still usable as they are, the next reset() tries merging them again
+				}
+			}
+
+			rewind({});
+		}
+
+		/**
+		 * Frees the blocks when they hold more than the given number of bytes, keeping a single block of that size.
+		 * Nothing can be allocated from the workspace at that point
+		 */
+		void shrink_to(std::size_t bytes) // @TODO: ISSUE #20
+		{
+			assert(current_block_ == 0 && offset_ == 0);
+
+			if (capacity() > bytes)
+			{
+				blocks_.clear();
+
+				if (bytes > 0)
+				{
+					add_block(bytes);
+				}
+			}
+
+			rewind({});
+		}
+
+		/**
+		 * Frees all the blocks. Nothing can be allocated from the workspace at that point
+		 */
+		void release() // @TODO: ISSUE #20
+		{
+			shrink_to(0);
+		}
+
+		/**
+		 * Most bytes reset() keeps around for the next computation, so one unusually big computation doesn't pin its
+		 * memory for as long as the workspace lives. Unlimited by default
+		 */
+		void set_retained_capacity(std::size_t bytes) noexcept // @TODO: ISSUE #20
+		{
+			retained_capacity_ = bytes;
+		}
+
+		[[nodiscard]] auto retained_capacity() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return retained_capacity_;
+		}
+
+		[[nodiscard]] auto capacity() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			auto total_size = std::size_t{};
+
+			for (const auto& current : blocks_)
+			{
+				total_size += current.size;
+			}
+
+			return total_size;
+		}
+
+		[[nodiscard]] auto block_count() const noexcept -> std::size_t // @TODO: ISSUE #20
+		{
+			return blocks_.size();
+		}
+	};
+
+	/**
+	 * Rewinds a workspace back to where it was when the scope was created
+	 */
+	class workspace_scope
+	{
+		workspace& workspace_;
+		workspace::marker marker_;
+
+	public:
+		explicit workspace_scope(workspace& arena) noexcept :
+			workspace_(arena),
+			marker_(arena.current_marker()) // @TODO: ISSUE #20
+		{
+		}
+
+		workspace_scope(const workspace_scope&) = delete;
+		auto operator=(const workspace_scope&) -> workspace_scope& = delete;
+
+		~workspace_scope()
+		{
+			// Merging blocks is only safe when nothing else is still allocated from the workspace
+			if (marker_.block == 0 && marker_.offset == 0)
+			{
+				workspace_.reset();
+			}
+			else
+			{
+				workspace_.rewind(marker_);
+			}
+		}
+	};
+
+	/**
+	 * Allocator drawing from a workspace. Deallocation does nothing, the memory is reclaimed when the workspace is
+	 * rewound
+	 */
+	template<typename Value>
+	class workspace_allocator
+	{
+		workspace* workspace_;
+
+		template<typename>
+		friend class workspace_allocator;
+
+	public:
+		using value_type = Value;
+
+		explicit workspace_allocator(workspace& arena) noexcept : workspace_(&arena) {} // @TODO: ISSUE #20
+
+		template<typename Other>
+		workspace_allocator(const workspace_allocator<Other>& right) noexcept :
+			workspace_(right.workspace_) // @TODO: ISSUE #20
+		{
+		}
+
+		[[nodiscard]] auto allocate(std::size_t size) -> Value* // @TODO: ISSUE #20
+		{
+			return static_cast<Value*>(workspace_->allocate(size * sizeof(Value), alignof(Value)));
+		}
+
+		void deallocate(Value*, std::size_t) noexcept {} // @TODO: ISSUE #20
+
+		template<typename Other>
+		[[nodiscard]] friend auto operator==(const workspace_allocator& left,
+			const workspace_allocator<Other>& right) noexcept -> bool // @TODO: ISSUE #20
+		{
+			return left.workspace_ == right.workspace_;
+		}
+	};
+
+	/**
+	 * Capacity the workspaces of threads keep between computations, see workspace::set_retained_capacity
+	 */
+	inline constexpr auto thread_workspace_retained_capacity = std::size_t{ 64 } * 1024 * 1024;
+
+	/**
+	 * Workspace owned by the calling thread, which algorithms use by default for their temporaries. Its capacity is
+	 * capped by thread_workspace_retained_capacity, and it can be given back early with release()
+	 */
+	[[nodiscard]] inline auto thread_workspace() -> workspace& // @TODO: ISSUE #20
+	{
+		thread_local auto arena = []() {
+			auto result = workspace{};
+			result.set_retained_capacity(thread_workspace_retained_capacity);
+
+			return result;
+		}();
+
+		return arena;
+	}
+} // namespace mpp
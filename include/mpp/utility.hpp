@@ -22,6 +22,8 @@
 // Don't include configuration.hpp because that is only for user customizations
 
 #include <mpp/utility/comparison.hpp>
+#include <mpp/utility/eval_into.hpp>
+#include <mpp/utility/layout.hpp>
 #include <mpp/utility/print.hpp>
 #include <mpp/utility/singular.hpp>
 #include <mpp/utility/square.hpp>
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <mpp/detail/expr/expr_base.hpp>
 #include <mpp/detail/utility/cpo_base.hpp>
 #include <mpp/matrix.hpp>
 
@@ -26,6 +27,8 @@
 #include <cmath>
 #include <compare>
 #include <cstddef>
+#include <functional>
+#include <limits>
 #include <type_traits>
 
 namespace mpp
@@ -52,6 +55,28 @@ namespace mpp
 			return { compare_rows ? left.rows() <=> right.rows() : std::partial_ordering::unordered,
 				compare_columns ? left.columns() <=> right.columns() : std::partial_ordering::unordered };
 		}
+
+		/**
+		 * Compares the sizes of any pair of expression objects, e.g. a matrix view and a matrix
+		 */
+		template<typename LeftExpr,
+			typename RightExpr,
+			typename LeftValue,
+			typename RightValue,
+			std::size_t LeftRowsExtent,
+			std::size_t LeftColumnsExtent,
+			std::size_t RightRowsExtent,
+			std::size_t RightColumnsExtent>
+		[[nodiscard]] friend inline auto tag_invoke(size_compare_t,
+			const detail::expr_base<LeftExpr, LeftValue, LeftRowsExtent, LeftColumnsExtent>& left,
+			const detail::expr_base<RightExpr, RightValue, RightRowsExtent, RightColumnsExtent>& right,
+			bool compare_rows,
+			bool compare_columns) noexcept
+			-> std::pair<std::partial_ordering, std::partial_ordering> // @TODO: ISSUE #20
+		{
+			return { compare_rows ? left.rows() <=> right.rows() : std::partial_ordering::unordered,
+				compare_columns ? left.columns() <=> right.columns() : std::partial_ordering::unordered };
+		}
 	};
 
 	struct elements_compare_t : public detail::cpo_base<elements_compare_t>
@@ -81,6 +106,51 @@ namespace mpp
 				right.end(),
 				compare_three_way_fn);
 		}
+
+		/**
+		 * Compares expression objects (or an expression object and a matrix) without evaluating them into a matrix
+		 * first. Elements are evaluated one at a time in row-major order, and it returns on the first pair that isn't
+		 * equivalent, which follows the same rules as comparing matrices
+		 */
+		template<typename LeftExpr,
+			typename RightExpr,
+			typename LeftValue,
+			typename RightValue,
+			std::size_t LeftRowsExtent,
+			std::size_t LeftColumnsExtent,
+			std::size_t RightRowsExtent,
+			std::size_t RightColumnsExtent,
+			typename CompareThreeway = std::compare_three_way>
+		[[nodiscard]] friend inline auto tag_invoke(elements_compare_t,
+			const detail::expr_base<LeftExpr, LeftValue, LeftRowsExtent, LeftColumnsExtent>& left,
+			const detail::expr_base<RightExpr, RightValue, RightRowsExtent, RightColumnsExtent>& right,
+			CompareThreeway compare_three_way_fn = {}) // @TODO: ISSUE #20
+			-> std::invoke_result_t<CompareThreeway&, LeftValue, RightValue>
+		{
+			const auto left_rows     = left.rows();
+			const auto left_columns  = left.columns();
+			const auto right_rows    = right.rows();
+			const auto right_columns = right.columns();
+
+			const auto left_size  = left_rows * left_columns;
+			const auto right_size = right_rows * right_columns;
+			const auto min_size   = std::min(left_size, right_size);
+
+			for (auto index = std::size_t{}; index < min_size; ++index)
+			{
+				// Both sides are walked as if they were flattened, because they can have different shapes
+				const auto ordering = std::invoke(compare_three_way_fn,
+					left(index / left_columns, index % left_columns),
+					right(index / right_columns, index % right_columns));
+
+				if (ordering != 0)
+				{
+					return ordering;
+				}
+			}
+
+			return left_size <=> right_size;
+		}
 	};
 
 	inline constexpr auto size_compare     = size_compare_t{};
@@ -125,18 +195,38 @@ namespace mpp
 	};
 
 	// @TODO: This is an odd place, maybe look for somewhere else to put it?
-	template<typename T,
-		typename T2,
+	template<typename Expr,
+		typename Expr2,
+		typename Value,
+		typename Value2,
 		std::size_t RowsExtent,
 		std::size_t RowsExtent2,
 		std::size_t ColumnsExtent,
-		std::size_t ColumnsExtent2,
-		typename Alloc,
-		typename Alloc2>
-	auto operator<=>(const matrix<T, RowsExtent, ColumnsExtent, Alloc>& mat,
-		const matrix<T2, RowsExtent2, ColumnsExtent2, Alloc2>& mat2) noexcept(noexcept(elements_compare(mat, mat2)))
-		-> bool
+		std::size_t ColumnsExtent2>
+	[[nodiscard]] auto operator<=>(const detail::expr_base<Expr, Value, RowsExtent, ColumnsExtent>& left,
+		const detail::expr_base<Expr2, Value2, RowsExtent2, ColumnsExtent2>& right)
 	{
-		return elements_compare(mat, mat2);
+		// Cast back to the derived types so matrices still get the fast path
+		return elements_compare(static_cast<const Expr&>(left), static_cast<const Expr2&>(right));
+	}
+
+	template<typename Expr,
+		typename Expr2,
+		typename Value,
+		typename Value2,
+		std::size_t RowsExtent,
+		std::size_t RowsExtent2,
+		std::size_t ColumnsExtent,
+		std::size_t ColumnsExtent2>
+	[[nodiscard]] auto operator==(const detail::expr_base<Expr, Value, RowsExtent, ColumnsExtent>& left,
+		const detail::expr_base<Expr2, Value2, RowsExtent2, ColumnsExtent2>& right) -> bool
+	{
+		// Unlike ordering, equality requires the same shape, so mismatching sizes don't evaluate any element
+		if (left.rows() != right.rows() || left.columns() != right.columns())
+		{
+			return false;
+		}
+
+		return elements_compare(static_cast<const Expr&>(left), static_cast<const Expr2&>(right)) == 0;
 	}
 } // namespace mpp
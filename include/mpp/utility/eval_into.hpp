@@ -0,0 +1,54 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#pragma once
+
+#include <mpp/detail/expr/expr_base.hpp>
+#include <mpp/detail/utility/cpo_base.hpp>
+#include <mpp/matrix.hpp>
+
+#include <concepts>
+#include <cstddef>
+
+namespace mpp
+{
+	struct eval_into_t : public detail::cpo_base<eval_into_t>
+	{
+		/**
+		 * Evaluates the expression directly into the storage of an existing matrix. Dynamic matrices only reallocate
+		 * when their capacity is too small for the result, so reusing a destination is allocation-free
+		 */
+		template<typename Value,
+			std::size_t RowsExtent,
+			std::size_t ColumnsExtent,
+			typename Allocator,
+			typename Expr,
+			std::convertible_to<Value> ExprValue,
+			std::size_t ExprRowsExtent,
+			std::size_t ExprColumnsExtent>
+		friend inline void tag_invoke(eval_into_t,
+			matrix<Value, RowsExtent, ColumnsExtent, Allocator>& dst,
+			const detail::expr_base<Expr, ExprValue, ExprRowsExtent, ExprColumnsExtent>& expr) // @TODO: ISSUE #20
+		{
+			dst = expr;
+		}
+	};
+
+	inline constexpr auto eval_into = eval_into_t{};
+} // namespace mpp
@@ -0,0 +1,62 @@
+/**
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#pragma once
+
+#include <cstddef>
+
+namespace mpp
+{
+	/**
+	 * Storage layouts of views. The stride of a layout is the distance between the first elements of two consecutive
+	 * rows (row-major) or columns (column-major), which is at least the length of a row or a column respectively
+	 */
+
+	struct row_major
+	{
+		[[nodiscard]] static constexpr auto index(std::size_t stride,
+			std::size_t row_index,
+			std::size_t col_index) noexcept -> std::size_t
+		{
+			return row_index * stride + col_index;
+		}
+
+		[[nodiscard]] static constexpr auto min_stride(std::size_t, std::size_t columns) noexcept -> std::size_t
+		{
+			return columns;
+		}
+	};
+
+	// Fortran (and LAPACK/BLAS) ordering, where the elements of a column are adjacent
+	struct column_major
+	{
+		[[nodiscard]] static constexpr auto index(std::size_t stride,
+			std::size_t row_index,
+			std::size_t col_index) noexcept -> std::size_t
+		{
+			return col_index * stride + row_index;
+		}
+
+		[[nodiscard]] static constexpr auto min_stride(std::size_t rows, std::size_t) noexcept -> std::size_t
+		{
+			return rows;
+		}
+	};
+} // namespace mpp
@@ -40,6 +40,16 @@ namespace mpp
 
 			std::cout << message_stream.str();
 		}
+
+		template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Layout>
+		friend inline auto tag_invoke(print_matrix_t,
+			const matrix_view<Value, RowsExtent, ColumnsExtent, Layout>& obj) -> void
+		{
+			auto message_stream = std::stringstream{};
+			detail::insert_expr_content_into_out_stream(message_stream, obj, "");
+
+			std::cout << message_stream.str();
+		}
 	};
 
 	template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Alloc>
@@ -49,5 +59,12 @@ namespace mpp
 		return os;
 	}
 
+	template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Layout>
+	auto operator<<(std::ostream& os, const matrix_view<Value, RowsExtent, ColumnsExtent, Layout>& obj) -> std::ostream&
+	{
+		detail::insert_expr_content_into_out_stream(os, obj, "");
+		return os;
+	}
+
 	inline constexpr auto print_matrix = print_matrix_t{};
 } // namespace mpp
@@ -23,6 +23,7 @@
 #include <mpp/detail/types/algo_types.hpp>
 #include <mpp/detail/utility/algorithm_helpers.hpp>
 #include <mpp/detail/utility/cpo_base.hpp>
+#include <mpp/memory/workspace.hpp>
 #include <mpp/utility/comparison.hpp>
 #include <mpp/matrix.hpp>
 
@@ -32,34 +33,56 @@
 
 namespace mpp
 {
+	namespace detail
+	{
+		template<typename Mat>
+		[[nodiscard]] inline auto singular_impl(const Mat& obj, workspace& arena) -> bool // @TODO: ISSUE #20
+		{
+			using fp_buffer_t = typename mat_rebind_to_t<Mat, default_floating_type>::buffer_type;
+
+			const auto dummy_l_buffer = 1;
+			const auto scope          = workspace_scope{ arena };
+			auto obj_buf_copy         = make_scratch_buffer<fp_buffer_t>(arena);
+
+			copy_into_buffer(obj_buf_copy, obj);
+
+			const auto det =
+				lu_generic<default_floating_type, false, true>(obj.rows(), obj.columns(), dummy_l_buffer, obj_buf_copy);
+
+			return fp_is_zero_or_nan(det);
+		}
+	} // namespace detail
+
 	struct singular_t : public detail::cpo_base<singular_t>
 	{
 		template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Allocator>
 		[[nodiscard]] friend inline auto tag_invoke(singular_t,
 			const matrix<Value, RowsExtent, ColumnsExtent, Allocator>& obj) -> bool // @TODO: ISSUE #20
 		{
-			using fp_matrix_t = matrix<detail::default_floating_type, RowsExtent, ColumnsExtent>;
-			using fp_buffer_t = typename fp_matrix_t::buffer_type;
-
-			const auto dummy_l_buffer = 1;
-			auto obj_buf_copy         = fp_buffer_t{};
+			return detail::singular_impl(obj, thread_workspace());
+		}
 
-			if constexpr (detail::is_vector<fp_buffer_t>::value)
-			{
-				obj_buf_copy.reserve(obj.size());
-				std::ranges::copy(obj, std::back_inserter(obj_buf_copy));
-			}
-			else
-			{
-				std::ranges::copy(obj, obj_buf_copy.begin());
-			}
+		template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Allocator>
+		[[nodiscard]] friend inline auto tag_invoke(singular_t,
+			const matrix<Value, RowsExtent, ColumnsExtent, Allocator>& obj,
+			workspace& arena) -> bool // @TODO: ISSUE #20
+		{
+			return detail::singular_impl(obj, arena);
+		}
 
-			const auto det = detail::lu_generic<detail::default_floating_type, false, true>(obj.rows(),
-				obj.columns(),
-				dummy_l_buffer,
-				obj_buf_copy);
+		template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Layout>
+		[[nodiscard]] friend inline auto tag_invoke(singular_t,
+			const matrix_view<Value, RowsExtent, ColumnsExtent, Layout>& obj) -> bool // @TODO: ISSUE #20
+		{
+			return detail::singular_impl(obj, thread_workspace());
+		}
 
-			return detail::fp_is_zero_or_nan(det);
+		template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Layout>
+		[[nodiscard]] friend inline auto tag_invoke(singular_t,
+			const matrix_view<Value, RowsExtent, ColumnsExtent, Layout>& obj,
+			workspace& arena) -> bool // @TODO: ISSUE #20
+		{
+			return detail::singular_impl(obj, arena);
 		}
 	};
 
@@ -34,6 +34,13 @@ namespace mpp
 		{
 			return obj.rows() == obj.columns();
 		}
+
+		template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Layout>
+		[[nodiscard]] friend inline auto tag_invoke(square_t,
+			const matrix_view<Value, RowsExtent, ColumnsExtent, Layout>& obj) noexcept -> bool // @TODO: ISSUE #20
+		{
+			return obj.rows() == obj.columns();
+		}
 	};
 
 	inline constexpr auto square = square_t{};
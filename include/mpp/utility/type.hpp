@@ -35,11 +35,10 @@ namespace mpp
 		dynamic_columns
 	};
 
-	struct type_t : public detail::cpo_base<type_t>
+	namespace detail
 	{
-		template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Allocator>
-		[[nodiscard]] friend inline auto tag_invoke(type_t,
-			const matrix<Value, RowsExtent, ColumnsExtent, Allocator>&) noexcept -> matrix_type // @TODO: ISSUE #20
+		template<std::size_t RowsExtent, std::size_t ColumnsExtent>
+		[[nodiscard]] constexpr auto type_impl() noexcept -> matrix_type
 		{
 			constexpr auto row_is_dynamic    = RowsExtent == dynamic;
 			constexpr auto column_is_dynamic = ColumnsExtent == dynamic;
@@ -61,6 +60,23 @@ namespace mpp
 				return matrix_type::dynamic_columns;
 			}
 		}
+	} // namespace detail
+
+	struct type_t : public detail::cpo_base<type_t>
+	{
+		template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Allocator>
+		[[nodiscard]] friend inline auto tag_invoke(type_t,
+			const matrix<Value, RowsExtent, ColumnsExtent, Allocator>&) noexcept -> matrix_type // @TODO: ISSUE #20
+		{
+			return detail::type_impl<RowsExtent, ColumnsExtent>();
+		}
+
+		template<typename Value, std::size_t RowsExtent, std::size_t ColumnsExtent, typename Layout>
+		[[nodiscard]] friend inline auto tag_invoke(type_t,
+			const matrix_view<Value, RowsExtent, ColumnsExtent, Layout>&) noexcept -> matrix_type // @TODO: ISSUE #20
+		{
+			return detail::type_impl<RowsExtent, ColumnsExtent>();
+		}
 	};
 
 	inline constexpr auto type = type_t{};